@@ -2,6 +2,7 @@
 #define SIMPLE_STL_ALLOCATOR_H
 
 #include <cstddef>      // size_t, ptrdiff_t
+#include <limits>       // numeric_limits
 #include <new>          // placement new
 #include <type_traits>
 
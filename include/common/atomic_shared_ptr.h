@@ -0,0 +1,195 @@
+/**
+ * @brief 可以被多个线程同时 load/store 的 shared_ptr：用于发布只读的配置快照，读者不加锁
+ *
+ * 分离计数（split reference count）：
+ *   每次 store 把 shared_ptr 放进一个新的节点 node，原子变量里只存一个64位字 = 节点指针(低48位) | 本地计数(高16位)
+ *   读者 load：CAS 给本地计数加一（此时节点不会被释放）-> 拷贝 node->value -> 把本地计数减回去
+ *   写者 exchange：一次原子交换换上新节点，旧字里的本地计数就是“还在读旧节点的读者数”，
+ *   把它加到旧节点自己的计数 node->refs 上；这些读者发现指针已经变了，转而去减 node->refs，最后一个归零的人释放节点
+ *
+ * 读者和写者都只在同一个64位原子变量上做 CAS/交换，没有互斥锁；读者持有本地计数的时间只有一次 shared_ptr 拷贝
+ * @note 要求64位平台且用户态地址不超过48位（x86-64、AArch64）；同时停留在 load() 内的读者不能超过 65535 个
+ */
+#ifndef SIMPLE_STL_COMMON_ATOMIC_SHARED_PTR_H
+#define SIMPLE_STL_COMMON_ATOMIC_SHARED_PTR_H
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "common/shared_ptr.h"
+
+namespace simple_stl {
+
+template <typename T>
+class atomic_shared_ptr
+{
+    static_assert(sizeof(void*) == 8, "atomic_shared_ptr packs a 48-bit pointer and a 16-bit count into one word");
+
+public:
+    using value_type = shared_ptr<T>;
+
+    atomic_shared_ptr() noexcept : word_(0) {}
+    atomic_shared_ptr(shared_ptr<T> desired) : word_(pack(make_node(std::move(desired)), 0)) {}
+
+    atomic_shared_ptr(const atomic_shared_ptr&) = delete;
+    atomic_shared_ptr& operator=(const atomic_shared_ptr&) = delete;
+
+    // 析构时不应再有其他线程访问，本地计数必然为0
+    ~atomic_shared_ptr() {
+        delete node_of(word_.load(std::memory_order_acquire));
+    }
+
+    bool is_lock_free() const noexcept { return word_.is_lock_free(); }
+
+    // 得到当前值的一份拷贝（快照），之后即使被 store 替换，快照中的对象也保持存活
+    shared_ptr<T> load() const {
+        std::uint64_t w = acquire_local();
+        Node* node = node_of(w);
+        if(!node) return shared_ptr<T>();
+        shared_ptr<T> result = node->value;
+        release_local(node);
+        return result;
+    }
+
+    operator shared_ptr<T>() const { return load(); }
+
+    void store(shared_ptr<T> desired) {
+        exchange(std::move(desired));
+    }
+
+    atomic_shared_ptr& operator=(shared_ptr<T> desired) {
+        store(std::move(desired));
+        return *this;
+    }
+
+    shared_ptr<T> exchange(shared_ptr<T> desired) {
+        Node* fresh = make_node(std::move(desired));
+        std::uint64_t old = word_.exchange(pack(fresh, 0), std::memory_order_acq_rel);
+        Node* node = node_of(old);
+        if(!node) return shared_ptr<T>();
+        // 其他读者可能还在拷贝 node->value，只能拷贝不能移走
+        shared_ptr<T> result = node->value;
+        retire(node, count_of(old));
+        return result;
+    }
+
+    /**
+     * @brief 当前值与 expected 等价（指向同一对象且属于同一个所有者）时替换为 desired 并返回 true；
+     * 否则把当前值写入 expected 并返回 false
+     */
+    bool compare_exchange_strong(shared_ptr<T>& expected, shared_ptr<T> desired) {
+        Node* fresh = make_node(std::move(desired));
+        for(;;){
+            std::uint64_t w = acquire_local();
+            Node* node = node_of(w);
+            const shared_ptr<T> empty;
+            const shared_ptr<T>& current = node ? node->value : empty;
+            if(!equivalent(current, expected)){
+                expected = current;
+                release_local(node);
+                delete fresh;
+                return false;
+            }
+            // 只要节点没变就可以替换；期间其他读者改变的只是本地计数
+            w = word_.load(std::memory_order_relaxed);
+            while(node_of(w) == node){
+                if(word_.compare_exchange_weak(w, pack(fresh, 0), std::memory_order_acq_rel, std::memory_order_relaxed)){
+                    // 本线程自己的那一次本地计数不用转移，直接抵消
+                    if(node) retire(node, count_of(w) - 1);
+                    return true;
+                }
+            }
+            // 被别的写者抢先替换了，重新比较
+            release_local(node);
+        }
+    }
+
+    // 没有伪失败，与 strong 版本相同
+    bool compare_exchange_weak(shared_ptr<T>& expected, shared_ptr<T> desired) {
+        return compare_exchange_strong(expected, std::move(desired));
+    }
+
+private:
+    struct Node
+    {
+        explicit Node(shared_ptr<T>&& v) : value(std::move(v)), refs(0) {}
+
+        shared_ptr<T> value;
+        // 从原子字上转移过来、尚未归还的读者计数；写者加上转移数，读者各减一，归零者释放节点
+        std::atomic<std::int64_t> refs;
+    };
+
+    static constexpr int count_shift = 48;
+    static constexpr std::uint64_t pointer_mask = (std::uint64_t(1) << count_shift) - 1;
+    static constexpr std::uint64_t one = std::uint64_t(1) << count_shift;
+    static constexpr std::uint64_t max_count = 0xFFFF;
+
+    mutable std::atomic<std::uint64_t> word_;
+
+    static Node* make_node(shared_ptr<T>&& value) {
+        return value ? new Node(std::move(value)) : nullptr;
+    }
+
+    static std::uint64_t pack(Node* node, std::uint64_t count) noexcept {
+        return reinterpret_cast<std::uintptr_t>(node) | (count << count_shift);
+    }
+    static Node* node_of(std::uint64_t w) noexcept {
+        return reinterpret_cast<Node*>(static_cast<std::uintptr_t>(w & pointer_mask));
+    }
+    static std::uint64_t count_of(std::uint64_t w) noexcept { return w >> count_shift; }
+
+    static bool equivalent(const shared_ptr<T>& a, const shared_ptr<T>& b) noexcept {
+        return a.get() == b.get() && !a.owner_before(b) && !b.owner_before(a);
+    }
+
+    /**
+     * @brief 在当前节点上登记一个本地计数并返回登记前的字；空指针不登记
+     * 用 CAS 而不是 fetch_add：空指针状态从不计数，避免“空 -> 非空 -> 空”之后把计数减在另一个空状态上
+     */
+    std::uint64_t acquire_local() const noexcept {
+        std::uint64_t w = word_.load(std::memory_order_relaxed);
+        for(;;){
+            if(!node_of(w)) return w;
+            if(count_of(w) == max_count){
+                // 本地计数已满，等其他读者退出
+                w = word_.load(std::memory_order_relaxed);
+                continue;
+            }
+            // acquire：与写者的交换同步，保证看到构造完成的 node->value
+            if(word_.compare_exchange_weak(w, w + one, std::memory_order_acquire, std::memory_order_relaxed)){
+                return w;
+            }
+        }
+    }
+
+    // 归还本地计数：节点还在原子字上就直接减，否则计数已被写者转移到 node->refs
+    void release_local(Node* node) const noexcept {
+        if(!node) return;
+        std::uint64_t w = word_.load(std::memory_order_relaxed);
+        while(node_of(w) == node){
+            if(word_.compare_exchange_weak(w, w - one, std::memory_order_release, std::memory_order_relaxed)){
+                return;
+            }
+        }
+        if(node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1){
+            delete node;
+        }
+    }
+
+    // 写者把旧节点上的本地计数转移到 node->refs；读者可能先减（refs 暂时为负），总和归零时才释放
+    static void retire(Node* node, std::uint64_t transferred) noexcept {
+        std::int64_t n = static_cast<std::int64_t>(transferred);
+        if(node->refs.fetch_add(n, std::memory_order_acq_rel) == -n){
+            delete node;
+        }
+    }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_COMMON_ATOMIC_SHARED_PTR_H
+
+/**
+ * @note 节点的地址不会出现 ABA：读者把计数转移给旧节点后，旧节点在该读者归还之前不会被释放，也就不会被新节点复用；
+ * 每次 store 都会分配一个节点，适合读多写少的场景（配置、路由表快照），频繁写入时应考虑其他结构
+ */
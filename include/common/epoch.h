@@ -0,0 +1,306 @@
+/**
+ * @brief 基于 epoch 的内存回收（EBR）：无锁容器摘下的节点先“退休”，确认没有线程还能看到它之后再释放
+ *
+ *   全局 epoch：单调递增的计数器
+ *   线程记录  ：每个线程在每个 domain 中有一条记录，保存 (本地 epoch << 1 | 活跃位) 和自己的退休列表
+ *   pin()     ：进入临界区，把本地 epoch 设为当前全局 epoch 并置活跃位；之后读到的节点在 guard 析构前都不会被释放
+ *   retire(p) ：记下 p 和当时的全局 epoch e，等全局 epoch 推进到 e + 2 后释放
+ *   推进条件  ：所有活跃线程的本地 epoch 都等于全局 epoch
+ *
+ * 读路径每次 pin 只有一次本地写 + 一次内存屏障，不修改任何共享计数，比 shared_ptr 的原子引用计数便宜得多
+ * @note 某个线程长时间停留在 pin 内会阻止 epoch 推进，所有退休节点都无法释放；长时间持有引用的读者应使用 hazard pointer
+ */
+#ifndef SIMPLE_STL_COMMON_EPOCH_H
+#define SIMPLE_STL_COMMON_EPOCH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "containers/vector.h"
+
+namespace simple_stl {
+
+class epoch_domain;
+
+namespace epoch_detail {
+
+using reclaim_fn = void (*)(void* p, void* ctx);
+
+struct retired
+{
+    void* ptr;
+    reclaim_fn reclaim;
+    void* ctx;
+    std::uint64_t epoch; // 退休时的全局 epoch
+};
+
+// 记录的归属：owned 被某个线程使用；free 可被新线程复用；orphaned domain 已析构，由线程退出时释放
+enum record_state : int { owned, free, orphaned };
+
+// 每条记录独占缓存行，线程更新本地 epoch 时不会干扰其他线程
+struct alignas(64) thread_record
+{
+    std::atomic<std::uint64_t> local{0};  // (epoch << 1) | 活跃位，不活跃时为0
+    std::atomic<int> state{owned};
+    thread_record* next = nullptr;        // 注册链表，发布后不再修改
+    std::size_t nesting = 0;              // pin 的嵌套层数，只有所属线程访问
+    simple_stl::vector<retired> limbo;    // 退休列表，只有所属线程访问
+};
+
+// 线程退出时交还本线程在各个 domain 中的记录
+struct thread_cache
+{
+    struct entry
+    {
+        std::uint64_t domain_id;
+        thread_record* record;
+    };
+    simple_stl::vector<entry> entries;
+
+    ~thread_cache() {
+        for(std::size_t i = 0; i < entries.size(); ++i){
+            release(entries[i].record);
+        }
+    }
+
+    // domain 仍然存在时把记录还给它（退休列表留给下一个使用者或 domain 析构时处理）；domain 已析构则由这里释放
+    static void release(thread_record* r) noexcept {
+        int expected = owned;
+        if(!r->state.compare_exchange_strong(expected, free, std::memory_order_acq_rel)){
+            delete r;
+        }
+    }
+};
+
+inline thread_cache& local_cache() {
+    thread_local thread_cache cache;
+    return cache;
+}
+
+// domain 编号永不复用，析构后新建的 domain 即使地址相同也不会与旧的缓存项混淆
+inline std::uint64_t next_domain_id() noexcept {
+    static std::atomic<std::uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+} // namespace epoch_detail
+
+class epoch_domain
+{
+public:
+    using size_type = std::size_t;
+
+    /**
+     * @brief RAII 临界区：构造时 pin，析构时退出；可以嵌套
+     * 在 guard 存活期间从无锁结构中读到的指针，即使已被其他线程 retire 也不会被释放
+     */
+    class guard
+    {
+    public:
+        explicit guard(epoch_domain& domain) : domain_(domain), record_(domain.local_record()) {
+            domain_.enter(record_);
+        }
+        ~guard() { domain_.leave(record_); }
+
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+
+    private:
+        epoch_domain& domain_;
+        epoch_detail::thread_record* record_;
+    };
+
+    // 退休列表达到 collect_threshold 时顺带尝试推进 epoch 并释放
+    explicit epoch_domain(size_type collect_threshold = 64)
+        : global_epoch_(1), head_(nullptr), id_(epoch_detail::next_domain_id()),
+          collect_threshold_(collect_threshold ? collect_threshold : 1) {}
+
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+
+    // 析构时不应再有线程使用本 domain：释放所有退休对象；仍被线程持有的记录交给线程退出时释放
+    ~epoch_domain() {
+        epoch_detail::thread_record* r = head_.load(std::memory_order_acquire);
+        while(r){
+            epoch_detail::thread_record* next = r->next;
+            for(size_type i = 0; i < r->limbo.size(); ++i){
+                const epoch_detail::retired& item = r->limbo[i];
+                item.reclaim(item.ptr, item.ctx);
+            }
+            r->limbo.clear();
+            int expected = epoch_detail::owned;
+            if(!r->state.compare_exchange_strong(expected, epoch_detail::orphaned, std::memory_order_acq_rel)){
+                delete r;
+            }
+            r = next;
+        }
+    }
+
+    // 进程内共享的默认 domain
+    static epoch_domain& global() {
+        static epoch_domain domain;
+        return domain;
+    }
+
+    guard pin() { return guard(*this); }
+
+    /*    ********************** 退休 **********************     */
+
+    // 通用形式：reclaim(p, ctx) 负责析构和释放
+    void retire(void* p, epoch_detail::reclaim_fn reclaim, void* ctx = nullptr) {
+        epoch_detail::thread_record* r = local_record();
+        r->limbo.push_back(epoch_detail::retired{p, reclaim, ctx, global_epoch_.load(std::memory_order_acquire)});
+        if(r->limbo.size() >= collect_threshold_){
+            try_advance();
+            reclaim_ready(r);
+        }
+    }
+
+    // 用 new 创建的对象
+    template <typename T>
+    void retire(T* p) {
+        retire(static_cast<void*>(p), [](void* q, void*){ delete static_cast<T*>(q); });
+    }
+
+    /**
+     * @brief 由分配器创建的节点：释放时先 destroy 再 deallocate，与容器的 createNode 对应
+     * 分配器必须无状态（例如 simple_stl::allocator），释放时会重新构造一个；有状态分配器请用通用形式并通过 ctx 传入
+     */
+    template <typename T, typename Allocator, typename = typename std::enable_if<!std::is_void<T>::value>::type>
+    void retire(T* p, const Allocator&) {
+        static_assert(std::is_empty<Allocator>::value, "epoch_domain::retire: stateful allocators need retire(p, reclaim, ctx)");
+        retire(static_cast<void*>(p), [](void* q, void*){
+            using NodeAllocator = typename Allocator::template rebind<T>::other;
+            NodeAllocator alloc;
+            T* node = static_cast<T*>(q);
+            alloc.destroy(node);
+            alloc.deallocate(node, 1);
+        });
+    }
+
+    /*    ********************** 推进与回收 **********************     */
+
+    // 所有活跃线程都已观察到当前 epoch 时推进一步；有线程落后则返回 false
+    bool try_advance() noexcept {
+        std::uint64_t g = global_epoch_.load(std::memory_order_seq_cst);
+        for(epoch_detail::thread_record* r = head_.load(std::memory_order_acquire); r; r = r->next){
+            std::uint64_t l = r->local.load(std::memory_order_seq_cst);
+            if((l & 1) && (l >> 1) != g){
+                return false;
+            }
+        }
+        return global_epoch_.compare_exchange_strong(g, g + 1, std::memory_order_seq_cst);
+    }
+
+    // 尝试推进并释放本线程中已经安全的退休对象，返回释放的个数
+    size_type collect() {
+        try_advance();
+        return reclaim_ready(local_record());
+    }
+
+    // 反复推进直到本线程的退休对象全部释放；其他线程一直停留在临界区时会一直等待
+    void synchronize() {
+        epoch_detail::thread_record* r = local_record();
+        while(!r->limbo.empty()){
+            try_advance();
+            reclaim_ready(r);
+        }
+    }
+
+    std::uint64_t epoch() const noexcept { return global_epoch_.load(std::memory_order_acquire); }
+
+    // 本线程尚未释放的退休对象个数
+    size_type pending() { return local_record()->limbo.size(); }
+
+private:
+    std::atomic<std::uint64_t> global_epoch_;
+    std::atomic<epoch_detail::thread_record*> head_;
+    const std::uint64_t id_;
+    const size_type collect_threshold_;
+
+    void enter(epoch_detail::thread_record* r) noexcept {
+        if(r->nesting++ == 0){
+            std::uint64_t g = global_epoch_.load(std::memory_order_relaxed);
+            r->local.store((g << 1) | 1, std::memory_order_relaxed);
+            // 本地 epoch 必须在之后读取任何共享指针之前对推进者可见
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    void leave(epoch_detail::thread_record* r) noexcept {
+        if(--r->nesting == 0){
+            // release：临界区内的读取都发生在“不活跃”被看到之前
+            r->local.store(0, std::memory_order_release);
+        }
+    }
+
+    // 退休时的 epoch 为 e，全局 epoch 到达 e + 2 时，退休前 pin 的线程都已离开临界区
+    size_type reclaim_ready(epoch_detail::thread_record* r) {
+        std::uint64_t g = global_epoch_.load(std::memory_order_acquire);
+        size_type kept = 0;
+        size_type freed = 0;
+        for(size_type i = 0; i < r->limbo.size(); ++i){
+            epoch_detail::retired item = r->limbo[i];
+            if(item.epoch + 2 <= g){
+                item.reclaim(item.ptr, item.ctx);
+                ++freed;
+            }else{
+                r->limbo[kept++] = item;
+            }
+        }
+        r->limbo.resize(kept);
+        return freed;
+    }
+
+    // 本线程在该 domain 中的记录：先查线程缓存，再复用空闲记录，最后新建并挂到注册链表头部
+    epoch_detail::thread_record* local_record() {
+        epoch_detail::thread_cache& cache = epoch_detail::local_cache();
+        for(size_type i = 0; i < cache.entries.size(); ++i){
+            if(cache.entries[i].domain_id == id_) return cache.entries[i].record;
+        }
+        prune_orphans(cache);
+
+        epoch_detail::thread_record* r = head_.load(std::memory_order_acquire);
+        for(; r; r = r->next){
+            int expected = epoch_detail::free;
+            if(r->state.load(std::memory_order_relaxed) == epoch_detail::free &&
+               r->state.compare_exchange_strong(expected, epoch_detail::owned, std::memory_order_acq_rel)){
+                break;
+            }
+        }
+        if(!r){
+            r = new epoch_detail::thread_record();
+            epoch_detail::thread_record* old_head = head_.load(std::memory_order_relaxed);
+            do{
+                r->next = old_head;
+            }while(!head_.compare_exchange_weak(old_head, r, std::memory_order_release, std::memory_order_relaxed));
+        }
+        cache.entries.push_back(epoch_detail::thread_cache::entry{id_, r});
+        return r;
+    }
+
+    // 已析构的 domain 留下的记录由本线程释放，避免缓存无限增长
+    static void prune_orphans(epoch_detail::thread_cache& cache) {
+        size_type kept = 0;
+        for(size_type i = 0; i < cache.entries.size(); ++i){
+            epoch_detail::thread_record* r = cache.entries[i].record;
+            if(r->state.load(std::memory_order_acquire) == epoch_detail::orphaned){
+                delete r;
+            }else{
+                cache.entries[kept++] = cache.entries[i];
+            }
+        }
+        cache.entries.resize(kept);
+    }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_COMMON_EPOCH_H
+
+/**
+ * @note 为什么是 e + 2：线程 pin 时读到的全局 epoch 可能已经落后一步，活跃线程的本地 epoch 只能是 g 或 g - 1，
+ * 全局 epoch 从 e 推进两次之后，所有在退休之前进入临界区的线程都必然已经离开
+ * @note 退休列表按线程划分，retire 不需要任何同步；释放由退休的线程自己完成，也可以调用 collect()/synchronize() 主动触发
+ */
@@ -0,0 +1,257 @@
+/**
+ * @brief Hazard pointer：读者在访问共享节点前把它的地址登记到一个槽位里，回收者只释放没有被任何槽位登记的节点
+ *
+ *   hazard_domain  ：所有槽位（hazard record）组成的链表 + 全局退休栈
+ *   hazptr_holder  ：RAII，构造时占用一个空闲槽位（没有就新建），析构时归还；protect() 登记并校验指针
+ *   retire(p)      ：把 p 压入退休栈；退休数达到阈值时由当前线程整批取走，收集所有槽位中的指针，
+ *                    未被登记的立即释放，仍被登记的放回退休栈
+ *
+ * 与 epoch（common/epoch.h）相比：读者停在临界区里只会保住它登记的那几个节点，其他退休节点照常释放，
+ * 未回收的内存不超过 槽位数 + 阈值；代价是每次 protect 都要一次 seq_cst 写和一次重新读取
+ */
+#ifndef SIMPLE_STL_COMMON_HAZARD_POINTER_H
+#define SIMPLE_STL_COMMON_HAZARD_POINTER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "containers/vector.h"
+
+namespace simple_stl {
+
+namespace hazptr_detail {
+
+using reclaim_fn = void (*)(void* p, void* ctx);
+
+// 槽位独占缓存行：读者频繁写自己的槽位，不应与其他槽位伪共享
+struct alignas(64) hazard_record
+{
+    std::atomic<const void*> ptr{nullptr};
+    std::atomic<bool> active{true};
+    hazard_record* next = nullptr; // 注册链表，发布后不再修改
+};
+
+struct retired_node
+{
+    void* ptr;
+    reclaim_fn reclaim;
+    void* ctx;
+    retired_node* next;
+};
+
+} // namespace hazptr_detail
+
+class hazard_domain;
+
+/**
+ * @brief 一个 hazard pointer 槽位的所有权；一个 holder 同一时刻保护一个指针，需要同时保护多个节点时使用多个 holder
+ */
+class hazptr_holder
+{
+public:
+    explicit hazptr_holder(hazard_domain& domain);
+    ~hazptr_holder() {
+        if(record_){
+            record_->ptr.store(nullptr, std::memory_order_release);
+            record_->active.store(false, std::memory_order_release);
+        }
+    }
+
+    hazptr_holder(const hazptr_holder&) = delete;
+    hazptr_holder& operator=(const hazptr_holder&) = delete;
+    hazptr_holder(hazptr_holder&& other) noexcept : record_(other.record_) { other.record_ = nullptr; }
+
+    /**
+     * @brief 读取 src 并登记，返回的指针在 reset_protection() 或 holder 析构前不会被释放
+     * 登记之后重新读取 src：值没变才说明登记发生在节点被摘下之前，回收者扫描时一定能看到它
+     */
+    template <typename T>
+    T* protect(const std::atomic<T*>& src) noexcept {
+        T* p = src.load(std::memory_order_relaxed);
+        for(;;){
+            record_->ptr.store(p, std::memory_order_seq_cst);
+            T* again = src.load(std::memory_order_seq_cst);
+            if(again == p) return p;
+            p = again;
+        }
+    }
+
+    // 调用方已经用其他方式保证 p 此刻有效时，直接登记
+    template <typename T>
+    void reset_protection(const T* p) noexcept {
+        record_->ptr.store(p, std::memory_order_seq_cst);
+    }
+    void reset_protection(std::nullptr_t = nullptr) noexcept {
+        record_->ptr.store(nullptr, std::memory_order_release);
+    }
+
+private:
+    hazptr_detail::hazard_record* record_;
+};
+
+class hazard_domain
+{
+public:
+    using size_type = std::size_t;
+
+    // 退休数达到 max(retire_threshold, 2 * 槽位数) 时扫描一次，保证每次扫描至少能释放一半
+    explicit hazard_domain(size_type retire_threshold = 64)
+        : records_(nullptr), record_count_(0), retired_(nullptr), retired_count_(0),
+          retire_threshold_(retire_threshold ? retire_threshold : 1) {}
+
+    hazard_domain(const hazard_domain&) = delete;
+    hazard_domain& operator=(const hazard_domain&) = delete;
+
+    // 析构时所有 holder 都应已销毁：释放全部退休对象和槽位
+    ~hazard_domain() {
+        hazptr_detail::retired_node* n = retired_.exchange(nullptr, std::memory_order_acquire);
+        while(n){
+            hazptr_detail::retired_node* next = n->next;
+            n->reclaim(n->ptr, n->ctx);
+            delete n;
+            n = next;
+        }
+        hazptr_detail::hazard_record* r = records_.load(std::memory_order_acquire);
+        while(r){
+            hazptr_detail::hazard_record* next = r->next;
+            delete r;
+            r = next;
+        }
+    }
+
+    static hazard_domain& global() {
+        static hazard_domain domain;
+        return domain;
+    }
+
+    /*    ********************** 退休 **********************     */
+
+    // 通用形式：fn(p, ctx) 负责析构和释放
+    void retire(void* p, hazptr_detail::reclaim_fn fn, void* ctx = nullptr) {
+        push_retired(new hazptr_detail::retired_node{p, fn, ctx, nullptr}, 1);
+        if(retired_count_.load(std::memory_order_relaxed) >= threshold()){
+            reclaim();
+        }
+    }
+
+    template <typename T>
+    void retire(T* p) {
+        retire(static_cast<void*>(p), [](void* q, void*){ delete static_cast<T*>(q); });
+    }
+
+    // 由分配器创建的节点，要求同 epoch_domain::retire(p, alloc)：分配器无状态
+    template <typename T, typename Allocator, typename = typename std::enable_if<!std::is_void<T>::value>::type>
+    void retire(T* p, const Allocator&) {
+        static_assert(std::is_empty<Allocator>::value, "hazard_domain::retire: stateful allocators need retire(p, reclaim, ctx)");
+        retire(static_cast<void*>(p), [](void* q, void*){
+            using NodeAllocator = typename Allocator::template rebind<T>::other;
+            NodeAllocator alloc;
+            T* node = static_cast<T*>(q);
+            alloc.destroy(node);
+            alloc.deallocate(node, 1);
+        });
+    }
+
+    /**
+     * @brief 立即扫描一次：取走整个退休栈，释放没有被任何槽位登记的对象，返回释放的个数
+     * 多个线程可以同时扫描，每个线程处理的是各自取走的那一批
+     */
+    size_type reclaim() {
+        hazptr_detail::retired_node* list = retired_.exchange(nullptr, std::memory_order_acquire);
+        if(!list) return 0;
+        size_type taken = 0;
+        for(hazptr_detail::retired_node* n = list; n; n = n->next) ++taken;
+        retired_count_.fetch_sub(taken, std::memory_order_relaxed);
+
+        // 与 protect 中的 seq_cst 写配对：节点在摘下之后才退休，此后登记的读者重新读取时会发现指针已变
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        simple_stl::vector<const void*> hazards;
+        for(hazptr_detail::hazard_record* r = records_.load(std::memory_order_acquire); r; r = r->next){
+            const void* p = r->ptr.load(std::memory_order_acquire);
+            if(p) hazards.push_back(p);
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        hazptr_detail::retired_node* keep_head = nullptr;
+        hazptr_detail::retired_node* keep_tail = nullptr;
+        size_type kept = 0;
+        size_type freed = 0;
+        while(list){
+            hazptr_detail::retired_node* n = list;
+            list = list->next;
+            if(std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(n->ptr))){
+                n->next = keep_head;
+                keep_head = n;
+                if(!keep_tail) keep_tail = n;
+                ++kept;
+            }else{
+                n->reclaim(n->ptr, n->ctx);
+                delete n;
+                ++freed;
+            }
+        }
+        if(keep_head) push_chain(keep_head, keep_tail, kept);
+        return freed;
+    }
+
+    // 已退休、尚未释放的对象个数
+    size_type pending() const noexcept { return retired_count_.load(std::memory_order_relaxed); }
+
+    // 当前的槽位总数（包括空闲的）
+    size_type slot_count() const noexcept { return record_count_.load(std::memory_order_relaxed); }
+
+private:
+    friend class hazptr_holder;
+
+    std::atomic<hazptr_detail::hazard_record*> records_;
+    std::atomic<size_type> record_count_;
+    std::atomic<hazptr_detail::retired_node*> retired_;
+    std::atomic<size_type> retired_count_;
+    const size_type retire_threshold_;
+
+    size_type threshold() const noexcept {
+        return std::max(retire_threshold_, 2 * record_count_.load(std::memory_order_relaxed));
+    }
+
+    // 优先复用空闲槽位；都被占用时新建一个挂到链表头部（槽位只增不减，直到 domain 析构）
+    hazptr_detail::hazard_record* acquire_record() {
+        for(hazptr_detail::hazard_record* r = records_.load(std::memory_order_acquire); r; r = r->next){
+            bool expected = false;
+            if(!r->active.load(std::memory_order_relaxed) &&
+               r->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)){
+                return r;
+            }
+        }
+        hazptr_detail::hazard_record* r = new hazptr_detail::hazard_record();
+        hazptr_detail::hazard_record* old_head = records_.load(std::memory_order_relaxed);
+        do{
+            r->next = old_head;
+        }while(!records_.compare_exchange_weak(old_head, r, std::memory_order_release, std::memory_order_relaxed));
+        record_count_.fetch_add(1, std::memory_order_relaxed);
+        return r;
+    }
+
+    void push_retired(hazptr_detail::retired_node* n, size_type count) {
+        push_chain(n, n, count);
+    }
+
+    void push_chain(hazptr_detail::retired_node* head, hazptr_detail::retired_node* tail, size_type count) {
+        hazptr_detail::retired_node* old_head = retired_.load(std::memory_order_relaxed);
+        do{
+            tail->next = old_head;
+        }while(!retired_.compare_exchange_weak(old_head, head, std::memory_order_release, std::memory_order_relaxed));
+        retired_count_.fetch_add(count, std::memory_order_relaxed);
+    }
+};
+
+inline hazptr_holder::hazptr_holder(hazard_domain& domain) : record_(domain.acquire_record()) {}
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_COMMON_HAZARD_POINTER_H
+
+/**
+ * @note 每个退休对象额外分配一个 retired_node，换来的是对被保护类型没有任何侵入要求（不需要继承基类或预留 next 指针）
+ * @note 阈值取 2 * 槽位数：任何时刻最多有 槽位数 个对象被保护，每次扫描至少释放一半，退休的均摊开销是 O(1)
+ */
@@ -0,0 +1,168 @@
+/**
+ * @brief 侵入式引用计数指针：计数存放在对象内部，intrusive_ptr 本身只有一个裸指针
+ *   与 shared_ptr 相比：没有单独的控制块，make 时不需要额外分配；任何拿到 this 的地方都能直接构造 intrusive_ptr，
+ *   不需要 enable_shared_from_this 那样先查一个 weak_ptr
+ *
+ *   intrusive_ptr<T> 通过 ADL 调用两个函数管理计数，被管理的类型只要提供它们即可：
+ *     intrusive_ptr_add_ref(const T*)  —— 加一
+ *     intrusive_ptr_release(const T*)  —— 减一，归零时销毁对象
+ *   intrusive_ref_counter<Derived, Policy> 是现成的实现，继承它就能使用；Policy 与 shared_ptr 相同，
+ *   atomic_refcount 可跨线程共享，local_refcount 只在单线程内使用
+ * @note 没有弱引用：对象的寿命只由计数决定，需要打破循环时改用裸指针或 shared_ptr/weak_ptr
+ */
+#ifndef SIMPLE_STL_COMMON_INTRUSIVE_PTR_H
+#define SIMPLE_STL_COMMON_INTRUSIVE_PTR_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "common/refcount.h"
+
+namespace simple_stl {
+
+/**
+ * @brief 计数混入基类：CRTP，计数归零时 delete static_cast<const Derived*>(this)
+ * 计数从0开始，第一个 intrusive_ptr 接管时变为1；拷贝对象不拷贝计数（新对象还没有任何所有者）
+ */
+template <typename Derived, typename Policy = atomic_refcount>
+class intrusive_ref_counter
+{
+public:
+    using size_type = std::size_t;
+
+    size_type use_count() const noexcept { return Policy::load(ref_count_); }
+
+protected:
+    intrusive_ref_counter() noexcept : ref_count_(0) {}
+    intrusive_ref_counter(const intrusive_ref_counter&) noexcept : ref_count_(0) {}
+    intrusive_ref_counter& operator=(const intrusive_ref_counter&) noexcept { return *this; }
+    // 非虚析构：删除时已经转换成 Derived*，不需要虚函数表
+    ~intrusive_ref_counter() = default;
+
+private:
+    // 计数不属于对象的逻辑状态，const 对象同样可以被共享
+    mutable typename Policy::count_type ref_count_;
+
+    friend void intrusive_ptr_add_ref(const intrusive_ref_counter* p) noexcept {
+        Policy::increment(p->ref_count_);
+    }
+
+    friend void intrusive_ptr_release(const intrusive_ref_counter* p) noexcept {
+        if(Policy::decrement(p->ref_count_) == 1){
+            delete static_cast<const Derived*>(p);
+        }
+    }
+};
+
+template <typename T>
+class intrusive_ptr
+{
+public:
+    using element_type = T;
+
+    intrusive_ptr() noexcept : ptr(nullptr) {}
+    intrusive_ptr(std::nullptr_t) noexcept : ptr(nullptr) {}
+
+    // add_ref 为 false 时接管一个已经计入的引用（与 detach() 配对）
+    explicit intrusive_ptr(T* p, bool add_ref = true) : ptr(p) {
+        if(ptr && add_ref) intrusive_ptr_add_ref(ptr);
+    }
+
+    intrusive_ptr(const intrusive_ptr& other) : ptr(other.ptr) {
+        if(ptr) intrusive_ptr_add_ref(ptr);
+    }
+
+    template <typename Y, typename = typename std::enable_if<std::is_convertible<Y*, T*>::value>::type>
+    intrusive_ptr(const intrusive_ptr<Y>& other) : ptr(other.get()) {
+        if(ptr) intrusive_ptr_add_ref(ptr);
+    }
+
+    intrusive_ptr(intrusive_ptr&& other) noexcept : ptr(other.ptr) {
+        other.ptr = nullptr;
+    }
+
+    template <typename Y, typename = typename std::enable_if<std::is_convertible<Y*, T*>::value>::type>
+    intrusive_ptr(intrusive_ptr<Y>&& other) noexcept : ptr(other.detach()) {}
+
+    ~intrusive_ptr() {
+        if(ptr) intrusive_ptr_release(ptr);
+    }
+
+    intrusive_ptr& operator=(const intrusive_ptr& other) {
+        intrusive_ptr(other).swap(*this);
+        return *this;
+    }
+    intrusive_ptr& operator=(intrusive_ptr&& other) noexcept {
+        intrusive_ptr(std::move(other)).swap(*this);
+        return *this;
+    }
+    template <typename Y>
+    intrusive_ptr& operator=(const intrusive_ptr<Y>& other) {
+        intrusive_ptr(other).swap(*this);
+        return *this;
+    }
+    template <typename Y>
+    intrusive_ptr& operator=(intrusive_ptr<Y>&& other) noexcept {
+        intrusive_ptr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    void reset() noexcept { intrusive_ptr().swap(*this); }
+    void reset(T* p, bool add_ref = true) { intrusive_ptr(p, add_ref).swap(*this); }
+
+    // 放弃所有权但不减计数，返回裸指针；之后由调用方负责用 intrusive_ptr(p, false) 接管或手动 release
+    T* detach() noexcept {
+        T* p = ptr;
+        ptr = nullptr;
+        return p;
+    }
+
+    T* get() const noexcept { return ptr; }
+    T& operator*() const noexcept { return *ptr; }
+    T* operator->() const noexcept { return ptr; }
+    explicit operator bool() const noexcept { return ptr != nullptr; }
+
+    void swap(intrusive_ptr& other) noexcept { std::swap(ptr, other.ptr); }
+
+    template <typename U>
+    friend bool operator==(const intrusive_ptr& a, const intrusive_ptr<U>& b) noexcept { return a.get() == b.get(); }
+    template <typename U>
+    friend bool operator!=(const intrusive_ptr& a, const intrusive_ptr<U>& b) noexcept { return a.get() != b.get(); }
+    friend bool operator==(const intrusive_ptr& a, std::nullptr_t) noexcept { return a.ptr == nullptr; }
+    friend bool operator!=(const intrusive_ptr& a, std::nullptr_t) noexcept { return a.ptr != nullptr; }
+    friend bool operator<(const intrusive_ptr& a, const intrusive_ptr& b) noexcept { return a.ptr < b.ptr; }
+
+private:
+    T* ptr;
+};
+
+// 对象本身就带计数，直接 new 即可，不存在 make_shared 那样的“控制块 + 对象”合并分配
+template <typename T, typename... Args>
+intrusive_ptr<T> make_intrusive(Args&&... args) {
+    return intrusive_ptr<T>(new T(std::forward<Args>(args)...));
+}
+
+template <typename T, typename U>
+intrusive_ptr<T> static_pointer_cast(const intrusive_ptr<U>& r) noexcept {
+    return intrusive_ptr<T>(static_cast<T*>(r.get()));
+}
+
+template <typename T, typename U>
+intrusive_ptr<T> dynamic_pointer_cast(const intrusive_ptr<U>& r) noexcept {
+    return intrusive_ptr<T>(dynamic_cast<T*>(r.get()));
+}
+
+template <typename T, typename U>
+intrusive_ptr<T> const_pointer_cast(const intrusive_ptr<U>& r) noexcept {
+    return intrusive_ptr<T>(const_cast<T*>(r.get()));
+}
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_COMMON_INTRUSIVE_PTR_H
+
+/**
+ * @note intrusive_ref_counter 的析构不是虚函数：通过 intrusive_ptr<Base> 释放 Derived 对象时，
+ * 要么 Base 自己有虚析构，要么 Derived 直接作为模板参数（intrusive_ref_counter<Derived>）；
+ * 多层继承时应让最顶层的基类继承 intrusive_ref_counter 并声明虚析构
+ */
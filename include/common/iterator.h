@@ -7,15 +7,17 @@
 
 #include <bits/c++config.h>
 #include <cstddef> 
+#include <iterator> // std::xxx_iterator_tag
 #include <type_traits>
 
 namespace simple_stl {
 
 // 迭代器标签定义
-struct input_iterator_tag {};                                      // 输入迭代器（仅支持读、单向遍历）
-struct forward_iterator_tag : input_iterator_tag {};               // 前向迭代器 （支持读写、单向遍历）
-struct bidirectional_iterator_tag : forward_iterator_tag {};       // 双向迭代器（读写）
-struct random_access_iterator_tag : bidirectional_iterator_tag {}; // 随机访问迭代器（支持读写、双向遍历+随机访问）
+// 直接使用标准库的标签类型：自定义容器的迭代器可以被 std::iterator_traits 识别，从而直接用于 std 算法
+using input_iterator_tag = std::input_iterator_tag;                 // 输入迭代器（仅支持读、单向遍历）
+using forward_iterator_tag = std::forward_iterator_tag;             // 前向迭代器 （支持读写、单向遍历）
+using bidirectional_iterator_tag = std::bidirectional_iterator_tag; // 双向迭代器（读写）
+using random_access_iterator_tag = std::random_access_iterator_tag; // 随机访问迭代器（支持读写、双向遍历+随机访问）
 
 // 基础模板（泛型迭代器）
 template<typename _Iterator>
@@ -47,6 +49,81 @@ struct iterator_traits<const _Tp*> {
     typedef const _Tp&                  reference;
 };
 
+/*    ********************** 反向迭代器 **********************     */
+// 适配任意双向迭代器：内部保存“正向位置”current_，解引用时访问它的前一个元素，因此 rbegin() == reverse_iterator(end())
+template<typename _Iterator>
+class reverse_iterator {
+public:
+    typedef _Iterator                                                 iterator_type;
+    typedef typename iterator_traits<_Iterator>::iterator_category   iterator_category;
+    typedef typename iterator_traits<_Iterator>::value_type          value_type;
+    typedef typename iterator_traits<_Iterator>::difference_type     difference_type;
+    typedef typename iterator_traits<_Iterator>::pointer             pointer;
+    typedef typename iterator_traits<_Iterator>::reference           reference;
+
+    reverse_iterator() : current_() {}
+    explicit reverse_iterator(_Iterator it) : current_(it) {}
+
+    // 允许 reverse_iterator<iterator> 转换为 reverse_iterator<const_iterator>
+    template<typename _Other, typename = typename std::enable_if<std::is_convertible<_Other, _Iterator>::value>::type>
+    reverse_iterator(const reverse_iterator<_Other>& other) : current_(other.base()) {}
+
+    _Iterator base() const { return current_; }
+
+    reference operator*() const {
+        _Iterator temp = current_;
+        return *--temp;
+    }
+    pointer operator->() const {
+        _Iterator temp = current_;
+        --temp;
+        return to_pointer(temp);
+    }
+
+    reverse_iterator& operator++() { --current_; return *this; }
+    reverse_iterator operator++(int) { reverse_iterator temp = *this; --current_; return temp; }
+    reverse_iterator& operator--() { ++current_; return *this; }
+    reverse_iterator operator--(int) { reverse_iterator temp = *this; ++current_; return temp; }
+
+    // 以下仅在底层为随机访问迭代器时可用（模板成员函数用到才实例化）
+    reverse_iterator& operator+=(difference_type n) { current_ -= n; return *this; }
+    reverse_iterator& operator-=(difference_type n) { current_ += n; return *this; }
+    reverse_iterator operator+(difference_type n) const { return reverse_iterator(current_ - n); }
+    reverse_iterator operator-(difference_type n) const { return reverse_iterator(current_ + n); }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+private:
+    template<typename _Ptr>
+    static _Ptr* to_pointer(_Ptr* p) { return p; }
+    template<typename _It>
+    static pointer to_pointer(const _It& it) { return it.operator->(); }
+
+    _Iterator current_;
+};
+
+// 比较运算：反向迭代器的先后关系与底层迭代器相反
+template<typename _It1, typename _It2>
+bool operator==(const reverse_iterator<_It1>& a, const reverse_iterator<_It2>& b) { return a.base() == b.base(); }
+template<typename _It1, typename _It2>
+bool operator!=(const reverse_iterator<_It1>& a, const reverse_iterator<_It2>& b) { return a.base() != b.base(); }
+template<typename _It1, typename _It2>
+bool operator<(const reverse_iterator<_It1>& a, const reverse_iterator<_It2>& b) { return b.base() < a.base(); }
+template<typename _It1, typename _It2>
+bool operator>(const reverse_iterator<_It1>& a, const reverse_iterator<_It2>& b) { return b.base() > a.base(); }
+template<typename _It1, typename _It2>
+bool operator<=(const reverse_iterator<_It1>& a, const reverse_iterator<_It2>& b) { return b.base() <= a.base(); }
+template<typename _It1, typename _It2>
+bool operator>=(const reverse_iterator<_It1>& a, const reverse_iterator<_It2>& b) { return b.base() >= a.base(); }
+
+template<typename _It1, typename _It2>
+auto operator-(const reverse_iterator<_It1>& a, const reverse_iterator<_It2>& b) -> decltype(b.base() - a.base()) {
+    return b.base() - a.base();
+}
+template<typename _Iterator>
+reverse_iterator<_Iterator> operator+(typename reverse_iterator<_Iterator>::difference_type n, const reverse_iterator<_Iterator>& it) {
+    return it + n;
+}
+
 } // namespace simple_stl
 
 #endif // SIMPLE_STL_ITERATOR_H
\ No newline at end of file
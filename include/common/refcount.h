@@ -0,0 +1,65 @@
+/**
+ * @brief 引用计数策略：shared_ptr、intrusive_ptr 等通过模板参数选择计数方式
+ * atomic_refcount —— 原子计数，可以跨线程共享（默认）
+ * local_refcount  —— 普通整数计数，只能在单个线程内使用，拷贝/析构没有原子读-改-写指令的开销
+ * 两者接口相同：count_type 是计数的存储类型，其余都是静态函数
+ */
+#ifndef SIMPLE_STL_COMMON_REFCOUNT_H
+#define SIMPLE_STL_COMMON_REFCOUNT_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace simple_stl {
+
+struct atomic_refcount
+{
+    using count_type = std::atomic<std::size_t>;
+
+    // 增加引用不需要同步任何数据：拿到指针的线程已经能看到对象
+    static void increment(count_type& c) noexcept {
+        c.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 返回减之前的值；acq_rel 保证最后一个释放者能看到其他线程对对象的所有修改后再析构
+    static std::size_t decrement(count_type& c) noexcept {
+        return c.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    // 只在计数非零时加一（weak_ptr::lock），已经归零的对象不能再“复活”
+    static bool increment_if_nonzero(count_type& c) noexcept {
+        std::size_t n = c.load(std::memory_order_relaxed);
+        while(n != 0){
+            if(c.compare_exchange_weak(n, n + 1, std::memory_order_acq_rel, std::memory_order_relaxed)){
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static std::size_t load(const count_type& c) noexcept {
+        return c.load(std::memory_order_acquire);
+    }
+};
+
+struct local_refcount
+{
+    using count_type = std::size_t;
+
+    static void increment(count_type& c) noexcept { ++c; }
+    static std::size_t decrement(count_type& c) noexcept { return c--; }
+    static bool increment_if_nonzero(count_type& c) noexcept {
+        if(c == 0) return false;
+        ++c;
+        return true;
+    }
+    static std::size_t load(const count_type& c) noexcept { return c; }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_COMMON_REFCOUNT_H
+
+/**
+ * @note 原子计数的代价主要不在指令本身，而在多核之间争抢同一条缓存行；
+ * 对象不会离开创建它的线程时（单线程的图结构、缓存），用 local_refcount 可以完全避免这部分开销
+ */
@@ -1,94 +1,347 @@
 /*六大成员函数、重写解引用和箭头运算符、引用计数（考虑线程安全）、重置指针*/
 /*
-    不考录删除器和空间配置器
-    不考虑弱引用
+    控制块：强/弱引用计数与“如何销毁对象、如何释放自己”放在一起，shared_ptr/weak_ptr 只持有对象指针和控制块指针
+    shared_ptr(p, deleter, alloc) —— 对象在外部分配，控制块保存指针、删除器和分配器（类型在控制块内擦除）
+    make_shared/allocate_shared   —— 对象直接构造在控制块内部，一次分配，计数和对象在相邻的内存上
+    weak_ptr                      —— 不拥有对象，只延长控制块的寿命，lock() 在对象仍存活时得到 shared_ptr
+    enable_shared_from_this       —— 对象内部保存一个指向自己的 weak_ptr，由拥有它的 shared_ptr 在构造时填好
+    local_shared_ptr              —— 计数策略换成 local_refcount 的 shared_ptr，只在单线程内使用，省去原子操作
 */
 #ifndef SIMPLE_STL_CONTAINERS_SHARED_PTR_H
 #define SIMPLE_STL_CONTAINERS_SHARED_PTR_H
 
-#include <atomic> // 引入原子操作
+#include <cstddef>
+#include <memory> // std::bad_weak_ptr
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "common/allocator.h"
+#include "common/refcount.h"  // atomic_refcount / local_refcount
+#include "common/unique_ptr.h"
+#include "common/utilities.h" // default_delete
+
 namespace simple_stl {
-template <typename T>
+
+// Policy 决定计数方式：默认 atomic_refcount 可跨线程共享；local_refcount 用普通整数，见 local_shared_ptr
+template <typename T, typename Policy = atomic_refcount> class shared_ptr;
+template <typename T, typename Policy = atomic_refcount> class weak_ptr;
+template <typename T, typename Policy = atomic_refcount> class enable_shared_from_this;
+
+namespace sp_detail {
+
+/**
+ * @brief 控制块基类
+ * shared_count：shared_ptr 的个数，归零时析构对象
+ * weak_count  ：weak_ptr 的个数 + (shared_count > 0 ? 1 : 0)，归零时释放控制块
+ * 所有 shared_ptr 合起来只占一个弱引用，这样 shared_ptr 的拷贝和析构只需要操作 shared_count
+ * 计数的读写全部交给 Policy，原子计数的内存序说明见 common/refcount.h
+ */
+template <typename Policy>
+class control_block
+{
+public:
+    using size_type = std::size_t;
+
+    control_block() noexcept : shared_count(1), weak_count(1) {}
+
+    void add_ref() noexcept {
+        Policy::increment(shared_count);
+    }
+
+    // weak_ptr::lock 使用：计数已经归零的对象不能再“复活”
+    bool add_ref_nonzero() noexcept {
+        return Policy::increment_if_nonzero(shared_count);
+    }
+
+    void release() noexcept {
+        if(Policy::decrement(shared_count) == 1){
+            dispose();
+            release_weak(); // 归还所有 shared_ptr 共同持有的那一个弱引用
+        }
+    }
+
+    void add_weak() noexcept {
+        Policy::increment(weak_count);
+    }
+
+    void release_weak() noexcept {
+        if(Policy::decrement(weak_count) == 1){
+            destroy();
+        }
+    }
+
+    size_type use_count() const noexcept {
+        return Policy::load(shared_count);
+    }
+
+protected:
+    virtual ~control_block() = default;
+
+private:
+    virtual void dispose() noexcept = 0; // 析构被管理的对象
+    virtual void destroy() noexcept = 0; // 释放控制块本身
+
+    typename Policy::count_type shared_count;
+    typename Policy::count_type weak_count;
+};
+
+// shared_ptr(p, d, a) 使用：对象在外部分配，控制块保存指针、删除器和分配器（分配器只用于分配控制块本身）
+template <typename Y, typename Deleter, typename Allocator, typename Policy>
+class ptr_control_block final : public control_block<Policy>
+{
+public:
+    using BlockAllocator = typename Allocator::template rebind<ptr_control_block>::other;
+
+    ptr_control_block(Y* p, Deleter d, const Allocator& alloc) : ptr(p), deleter_(std::move(d)), alloc_(alloc) {}
+
+private:
+    void dispose() noexcept override { deleter_(ptr); }
+
+    // 先拷贝出分配器再析构自己，最后归还内存
+    void destroy() noexcept override {
+        BlockAllocator block_alloc(alloc_);
+        this->~ptr_control_block();
+        block_alloc.deallocate(this, 1);
+    }
+
+    Y* ptr;
+    Deleter deleter_;
+    Allocator alloc_;
+};
+
+// make_shared/allocate_shared 使用：对象存放在控制块内部，整块内存由 Allocator 分配
+template <typename T, typename Allocator, typename Policy>
+class inplace_control_block final : public control_block<Policy>
+{
+public:
+    using BlockAllocator = typename Allocator::template rebind<inplace_control_block>::other;
+
+    template <typename... Args>
+    explicit inplace_control_block(const Allocator& alloc, Args&&... args) : alloc_(alloc) {
+        ::new(static_cast<void*>(&storage_)) T(std::forward<Args>(args)...);
+    }
+
+    T* object() noexcept { return reinterpret_cast<T*>(&storage_); }
+
+private:
+    // 对象在强引用归零时析构，但内存要等弱引用也归零、控制块释放时才一起归还
+    void dispose() noexcept override { object()->~T(); }
+
+    void destroy() noexcept override {
+        BlockAllocator block_alloc(alloc_);
+        this->~inplace_control_block();
+        block_alloc.deallocate(this, 1);
+    }
+
+    Allocator alloc_;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+};
+
+// 标记：接管一个已经计入本次引用的控制块，放在第一个参数，与 (指针, 删除器, 分配器) 构造区分开
+struct adopt_t {};
+
+// Y* 可以隐式转换为 T* 时才允许 shared_ptr<Y> -> shared_ptr<T>
+template <typename Y, typename T>
+using enable_if_compatible = typename std::enable_if<std::is_convertible<Y*, T*>::value>::type;
+
+// make_shared/allocate_shared 及其 local 版本的共同实现
+template <typename T, typename Policy, typename Allocator, typename... Args>
+shared_ptr<T, Policy> allocate_shared_with(const Allocator& alloc, Args&&... args);
+
+} // namespace sp_detail
+
+template <typename T, typename Policy>
 class shared_ptr
 {
 public:
     using size_type = std::size_t;
+    using element_type = T;
+    using weak_type = weak_ptr<T, Policy>;
+    using policy_type = Policy;
 
 private:
+    using control_block_type = sp_detail::control_block<Policy>;
+
     /* data */
     T* ptr;
-    std::atomic<size_type>* ref_count; // 计数
+    control_block_type* ctrl; // 控制块（含计数）
+
+    template <typename, typename> friend class shared_ptr;
+    template <typename, typename> friend class weak_ptr;
+    template <typename U, typename P, typename Allocator, typename... Args>
+    friend shared_ptr<U, P> sp_detail::allocate_shared_with(const Allocator& alloc, Args&&... args);
 
-    // 释放资源 内存序接口
+    // 接管已经持有一个强引用的控制块（allocate_shared、weak_ptr::lock 使用）
+    shared_ptr(sp_detail::adopt_t, T* p, control_block_type* block) noexcept : ptr(p), ctrl(block) {}
+
+    // 释放资源
     void release(){
-        // memory_order_relaxed 不关注原子操作顺序，仅保证原子操作本身的原子性
-        // memory_order_acquire “确保自己的信息是最新的同步结果” 允许cpu对前面的读写指令向后排，不允许cpu将后面的读写指令前排
-        // memory_order_release “只保证自己的修改被同步” 不允许cpu对前面的读写指令进行重拍，不允许写指令前排，允许cpu将后面的读指令前排，
-        // memory_order_acq_rel 进入该操作时同步别人的修改，离开该操作时让别人同步自己的修改
-        if(ref_count && ref_count->fetch_sub(1,std::memory_order_acq_rel) == 1){
-            delete ptr;
-            delete ref_count;
+        if(ctrl){
+            ctrl->release();
+        }
+    }
+
+    // 为 p 分配控制块；分配失败时用删除器销毁 p，避免泄漏
+    template <typename Y, typename Deleter, typename Allocator>
+    void acquire(Y* p, Deleter d, const Allocator& alloc) {
+        using Block = sp_detail::ptr_control_block<Y, Deleter, Allocator, Policy>;
+        typename Block::BlockAllocator block_alloc(alloc);
+        Block* block = nullptr;
+        try
+        {
+            block = block_alloc.allocate(1);
+            ::new(static_cast<void*>(block)) Block(p, d, alloc);
+        }
+        catch(...)
+        {
+            if(block) block_alloc.deallocate(block, 1);
+            d(p);
+            throw;
         }
+        ctrl = block;
+        enable_weak_this(p, p);
     }
+
+    // 对象继承自 enable_shared_from_this 时，把自己登记到对象内部的 weak_ptr 上
+    template <typename U, typename Y>
+    void enable_weak_this(const enable_shared_from_this<U, Policy>* base, Y* p) noexcept {
+        if(base && base->weak_this_.expired()){
+            base->weak_this_ = shared_ptr<U, Policy>(*this, const_cast<U*>(static_cast<const U*>(p)));
+        }
+    }
+    void enable_weak_this(...) noexcept {}
+
 public:
-    shared_ptr(): ptr(nullptr), ref_count(nullptr) {}
+    shared_ptr(): ptr(nullptr), ctrl(nullptr) {}
+    shared_ptr(std::nullptr_t): ptr(nullptr), ctrl(nullptr) {}
+
     // 加入explicit防止发生 share_ptr(int) p = new int(200) 类似的隐式类型转换
-    explicit shared_ptr(T* p): ptr(p), ref_count(p? new std::atomic<size_type>(1): nullptr) {}
-    
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    explicit shared_ptr(Y* p): ptr(p), ctrl(nullptr) {
+        if(p) acquire(p, simple_stl::default_delete<Y>(), simple_stl::allocator<Y>());
+    }
+
+    // 自定义删除器：最后一个 shared_ptr 析构时调用 d(p)
+    template <typename Y, typename Deleter, typename = sp_detail::enable_if_compatible<Y, T>>
+    shared_ptr(Y* p, Deleter d): ptr(p), ctrl(nullptr) {
+        acquire(p, std::move(d), simple_stl::allocator<Y>());
+    }
+
+    // 自定义删除器 + 分配器：分配器用于分配控制块
+    template <typename Y, typename Deleter, typename Allocator, typename = sp_detail::enable_if_compatible<Y, T>>
+    shared_ptr(Y* p, Deleter d, const Allocator& alloc): ptr(p), ctrl(nullptr) {
+        acquire(p, std::move(d), alloc);
+    }
+
+    /**
+     * @brief 别名构造：与 r 共享所有权（同一个控制块），但 get() 返回 p
+     * 典型用法是指向被管理对象的某个成员：shared_ptr<Member>(owner, &owner->member)
+     */
+    template <typename Y>
+    shared_ptr(const shared_ptr<Y, Policy>& r, T* p) noexcept : ptr(p), ctrl(r.ctrl) {
+        if(ctrl) ctrl->add_ref();
+    }
+
+    // 从 weak_ptr 构造：对象已经析构时抛出 std::bad_weak_ptr
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    explicit shared_ptr(const weak_ptr<Y, Policy>& r): ptr(nullptr), ctrl(nullptr) {
+        if(!r.ctrl || !r.ctrl->add_ref_nonzero()){
+            throw std::bad_weak_ptr();
+        }
+        ptr = r.ptr;
+        ctrl = r.ctrl;
+    }
+
+    // 从 unique_ptr 接管对象和删除器；控制块分配失败时对象由删除器销毁
+    template <typename Y, typename Deleter, typename = sp_detail::enable_if_compatible<Y, T>>
+    shared_ptr(unique_ptr<Y, Deleter>&& r): ptr(r.get()), ctrl(nullptr) {
+        if(ptr){
+            Deleter d(std::move(r.get_deleter()));
+            acquire(r.release(), std::move(d), simple_stl::allocator<Y>());
+        }
+    }
+
     ~shared_ptr() {
         release();
     }
 
     // 拷贝构造函数
-    shared_ptr(const shared_ptr<T>& other): ptr(other.ptr),ref_count(other.ref_count) {
-        if(ref_count) {
-            ref_count->fetch_add(1,std::memory_order_relaxed);
+    shared_ptr(const shared_ptr<T, Policy>& other): ptr(other.ptr),ctrl(other.ctrl) {
+        if(ctrl) {
+            ctrl->add_ref();
+        }
+    }
+
+    // shared_ptr<Derived> -> shared_ptr<Base>
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    shared_ptr(const shared_ptr<Y, Policy>& other): ptr(other.ptr), ctrl(other.ctrl) {
+        if(ctrl) {
+            ctrl->add_ref();
         }
     }
 
     // 拷贝赋值运算符
-    shared_ptr<T>& operator=(const shared_ptr<T>& other) {
+    shared_ptr<T, Policy>& operator=(const shared_ptr<T, Policy>& other) {
         // 内存地址不相等则释放当前资源，并拷贝成员变量
         if(this != &other) {
+            // 先增加对方的计数再释放自己：两者指向同一对象时不会提前析构
+            if(other.ctrl) {
+                other.ctrl->add_ref();
+            }
             release();
             ptr = other.ptr;
-            ref_count = other.ref_count;
-            if(ref_count) {
-                // 只执行递增操作，不需要重新赋值ref_count指针
-                ref_count->fetch_add(1, std::memory_order_relaxed);
-            }
+            ctrl = other.ctrl;
         }
         return *this;
     }
 
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    shared_ptr<T, Policy>& operator=(const shared_ptr<Y, Policy>& other) {
+        shared_ptr<T, Policy>(other).swap(*this);
+        return *this;
+    }
+
     // 移动构造函数
-    shared_ptr(shared_ptr<T>&& other) noexcept : ptr(other.ptr), ref_count(other.ref_count) {
+    shared_ptr(shared_ptr<T, Policy>&& other) noexcept : ptr(other.ptr), ctrl(other.ctrl) {
         other.ptr = nullptr;
-        other.ref_count = nullptr;
+        other.ctrl = nullptr;
+    }
+
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    shared_ptr(shared_ptr<Y, Policy>&& other) noexcept : ptr(other.ptr), ctrl(other.ctrl) {
+        other.ptr = nullptr;
+        other.ctrl = nullptr;
     }
 
     // 为什么"运算符"返回类型是 T& 对象别名：返回 “=”左操作数的别名，支持 a = b = c = d 链式操作，每一步生成并返回左操作数如c的别名，避免每一步都要生成c的副本
-    shared_ptr<T>& operator= (shared_ptr<T>&& other) noexcept{
+    shared_ptr<T, Policy>& operator= (shared_ptr<T, Policy>&& other) noexcept{
         if(this != &other){
             release();
             ptr = other.ptr;
-            ref_count = other.ref_count;
+            ctrl = other.ctrl;
             other.ptr = nullptr;
-            other.ref_count = nullptr;
+            other.ctrl = nullptr;
         }
         return *this; // 语义层面：函数可以根据返回值是引用类型，而将对象本身处理为对该对象的引用
     }
 
-    
-    T& operator*() const { 
-        return *ptr;  // T类型对象本身 
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    shared_ptr<T, Policy>& operator=(shared_ptr<Y, Policy>&& other) noexcept {
+        shared_ptr<T, Policy>(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    // T 为 void 时不能形成 void&，用 add_lvalue_reference 推迟到真正调用时才出错
+    typename std::add_lvalue_reference<T>::type operator*() const {
+        return *ptr;  // T类型对象本身
     }
 
     // 箭头运算符原始语义：通过指针访问对象的成员 p->member = (*p).member, 因此重写时要返回shared_ptr的T*类型指针成员变量
     T* operator->() const { return ptr; }
 
     size_type use_count()  const{
-        return ref_count? ref_count->load(std::memory_order_acquire) : 0;
+        return ctrl? ctrl->use_count() : 0;
     }
 
     // const修饰函数确保编译期间不会修改类的任何非mutable成员变量
@@ -97,14 +350,228 @@ public:
         return ptr; // 返回指针本身（地址），指针本身const（地址不变，数据可变）
     }
 
+    explicit operator bool() const noexcept { return ptr != nullptr; }
+
     // 重置指针
-    void reset(T* p = nullptr) {
-        release();
-        ptr = p;
-        ref_count = p? new std::atomic<size_type>(1) : nullptr;
+    void reset() noexcept {
+        shared_ptr<T, Policy>().swap(*this);
+    }
+    template <typename Y>
+    void reset(Y* p) {
+        shared_ptr<T, Policy>(p).swap(*this);
+    }
+    template <typename Y, typename Deleter>
+    void reset(Y* p, Deleter d) {
+        shared_ptr<T, Policy>(p, std::move(d)).swap(*this);
+    }
+    template <typename Y, typename Deleter, typename Allocator>
+    void reset(Y* p, Deleter d, const Allocator& alloc) {
+        shared_ptr<T, Policy>(p, std::move(d), alloc).swap(*this);
     }
+
+    void swap(shared_ptr<T, Policy>& other) noexcept {
+        std::swap(ptr, other.ptr);
+        std::swap(ctrl, other.ctrl);
+    }
+
+    // 按控制块（所有权）而不是对象地址排序，别名指针与原指针视为同一个所有者
+    template <typename Y>
+    bool owner_before(const shared_ptr<Y, Policy>& other) const noexcept { return ctrl < other.ctrl; }
+    template <typename Y>
+    bool owner_before(const weak_ptr<Y, Policy>& other) const noexcept { return ctrl < other.ctrl; }
+
+    friend bool operator==(const shared_ptr<T, Policy>& a, const shared_ptr<T, Policy>& b) noexcept { return a.ptr == b.ptr; }
+    friend bool operator!=(const shared_ptr<T, Policy>& a, const shared_ptr<T, Policy>& b) noexcept { return a.ptr != b.ptr; }
+    friend bool operator==(const shared_ptr<T, Policy>& a, std::nullptr_t) noexcept { return a.ptr == nullptr; }
+    friend bool operator!=(const shared_ptr<T, Policy>& a, std::nullptr_t) noexcept { return a.ptr != nullptr; }
 };
 
+/**
+ * @brief 弱引用：不影响对象的寿命，只保证控制块存活，从而可以安全地查询对象是否已经析构
+ * 用于打破 shared_ptr 的循环引用（例如双向链表的 prev 指针）
+ */
+template <typename T, typename Policy>
+class weak_ptr
+{
+public:
+    using size_type = std::size_t;
+    using element_type = T;
+
+    weak_ptr() noexcept : ptr(nullptr), ctrl(nullptr) {}
+
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    weak_ptr(const shared_ptr<Y, Policy>& r) noexcept : ptr(r.ptr), ctrl(r.ctrl) {
+        if(ctrl) ctrl->add_weak();
+    }
+
+    weak_ptr(const weak_ptr& other) noexcept : ptr(other.ptr), ctrl(other.ctrl) {
+        if(ctrl) ctrl->add_weak();
+    }
+
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    weak_ptr(const weak_ptr<Y, Policy>& other) noexcept : ptr(nullptr), ctrl(other.ctrl) {
+        // 对象可能已经析构，Y* -> T* 的转换（虚基类时）需要访问对象，因此先 lock 再取指针
+        if(ctrl){
+            ptr = other.lock().get();
+            ctrl->add_weak();
+        }
+    }
+
+    weak_ptr(weak_ptr&& other) noexcept : ptr(other.ptr), ctrl(other.ctrl) {
+        other.ptr = nullptr;
+        other.ctrl = nullptr;
+    }
+
+    ~weak_ptr() {
+        if(ctrl) ctrl->release_weak();
+    }
+
+    weak_ptr& operator=(const weak_ptr& other) noexcept {
+        weak_ptr(other).swap(*this);
+        return *this;
+    }
+    weak_ptr& operator=(weak_ptr&& other) noexcept {
+        weak_ptr(std::move(other)).swap(*this);
+        return *this;
+    }
+    template <typename Y, typename = sp_detail::enable_if_compatible<Y, T>>
+    weak_ptr& operator=(const shared_ptr<Y, Policy>& r) noexcept {
+        weak_ptr(r).swap(*this);
+        return *this;
+    }
+
+    size_type use_count() const noexcept { return ctrl ? ctrl->use_count() : 0; }
+    bool expired() const noexcept { return use_count() == 0; }
+
+    // 对象仍然存活时返回一个新的 shared_ptr，否则返回空指针；检查与加计数是一次原子操作，不存在竞态
+    shared_ptr<T, Policy> lock() const noexcept {
+        if(ctrl && ctrl->add_ref_nonzero()){
+            return shared_ptr<T, Policy>(sp_detail::adopt_t(), ptr, ctrl);
+        }
+        return shared_ptr<T, Policy>();
+    }
+
+    void reset() noexcept { weak_ptr().swap(*this); }
+
+    void swap(weak_ptr& other) noexcept {
+        std::swap(ptr, other.ptr);
+        std::swap(ctrl, other.ctrl);
+    }
+
+    template <typename Y>
+    bool owner_before(const shared_ptr<Y, Policy>& other) const noexcept { return ctrl < other.ctrl; }
+    template <typename Y>
+    bool owner_before(const weak_ptr<Y, Policy>& other) const noexcept { return ctrl < other.ctrl; }
+
+private:
+    template <typename, typename> friend class shared_ptr;
+    template <typename, typename> friend class weak_ptr;
+
+    T* ptr;
+    sp_detail::control_block<Policy>* ctrl;
+};
+
+/**
+ * @brief 继承它的类可以在成员函数里通过 shared_from_this() 拿到管理自己的 shared_ptr
+ * 直接 shared_ptr<T>(this) 会新建第二个控制块，造成重复释放；这里复用已有的控制块
+ * @note 对象必须已经被某个 shared_ptr 管理，否则 shared_from_this() 抛出 std::bad_weak_ptr
+ * @note Policy 要与管理对象的 shared_ptr 一致，local_shared_ptr 管理的对象应继承 enable_shared_from_this<T, local_refcount>
+ */
+template <typename T, typename Policy>
+class enable_shared_from_this
+{
+protected:
+    enable_shared_from_this() noexcept = default;
+    // 拷贝对象时不拷贝 weak_this_：新对象属于另一个所有者
+    enable_shared_from_this(const enable_shared_from_this&) noexcept {}
+    enable_shared_from_this& operator=(const enable_shared_from_this&) noexcept { return *this; }
+    ~enable_shared_from_this() = default;
+
+public:
+    shared_ptr<T, Policy> shared_from_this() { return shared_ptr<T, Policy>(weak_this_); }
+    shared_ptr<const T, Policy> shared_from_this() const { return shared_ptr<const T, Policy>(weak_this_); }
+    weak_ptr<T, Policy> weak_from_this() noexcept { return weak_this_; }
+    weak_ptr<const T, Policy> weak_from_this() const noexcept { return weak_this_; }
+
+private:
+    template <typename, typename> friend class shared_ptr;
+
+    mutable weak_ptr<T, Policy> weak_this_;
+};
+
+namespace sp_detail {
+
+/**
+ * @brief 用 alloc 一次性分配“控制块 + 对象”，并在其中构造对象
+ * 分配器被 rebind 到控制块类型，控制块内保存一份分配器，控制块释放时用它归还整块内存
+ */
+template <typename T, typename Policy, typename Allocator, typename... Args>
+shared_ptr<T, Policy> allocate_shared_with(const Allocator& alloc, Args&&... args) {
+    using Block = inplace_control_block<T, Allocator, Policy>;
+    typename Block::BlockAllocator block_alloc(alloc);
+    Block* block = block_alloc.allocate(1);
+    try
+    {
+        ::new(static_cast<void*>(block)) Block(alloc, std::forward<Args>(args)...);
+    }
+    catch(...)
+    {
+        block_alloc.deallocate(block, 1);
+        throw;
+    }
+    shared_ptr<T, Policy> result(adopt_t(), block->object(), block);
+    result.enable_weak_this(block->object(), block->object());
+    return result;
+}
+
+} // namespace sp_detail
+
+template <typename T, typename Allocator, typename... Args>
+shared_ptr<T> allocate_shared(const Allocator& alloc, Args&&... args) {
+    return sp_detail::allocate_shared_with<T, atomic_refcount>(alloc, std::forward<Args>(args)...);
+}
+
+template <typename T, typename... Args>
+shared_ptr<T> make_shared(Args&&... args) {
+    return simple_stl::allocate_shared<T>(simple_stl::allocator<T>(), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief 单线程版本：计数是普通整数，拷贝/析构不需要原子读-改-写
+ * 接口与 shared_ptr/weak_ptr 完全相同，但同一个对象的所有 local_shared_ptr、local_weak_ptr 只能在一个线程内使用；
+ * 与 shared_ptr 之间不能互相转换（控制块的计数类型不同）
+ */
+template <typename T>
+using local_shared_ptr = shared_ptr<T, local_refcount>;
+template <typename T>
+using local_weak_ptr = weak_ptr<T, local_refcount>;
+
+template <typename T, typename Allocator, typename... Args>
+local_shared_ptr<T> allocate_local_shared(const Allocator& alloc, Args&&... args) {
+    return sp_detail::allocate_shared_with<T, local_refcount>(alloc, std::forward<Args>(args)...);
+}
+
+template <typename T, typename... Args>
+local_shared_ptr<T> make_local_shared(Args&&... args) {
+    return simple_stl::allocate_local_shared<T>(simple_stl::allocator<T>(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename U, typename Policy>
+shared_ptr<T, Policy> static_pointer_cast(const shared_ptr<U, Policy>& r) noexcept {
+    return shared_ptr<T, Policy>(r, static_cast<T*>(r.get()));
+}
+
+template <typename T, typename U, typename Policy>
+shared_ptr<T, Policy> dynamic_pointer_cast(const shared_ptr<U, Policy>& r) noexcept {
+    T* p = dynamic_cast<T*>(r.get());
+    return p ? shared_ptr<T, Policy>(r, p) : shared_ptr<T, Policy>();
+}
+
+template <typename T, typename U, typename Policy>
+shared_ptr<T, Policy> const_pointer_cast(const shared_ptr<U, Policy>& r) noexcept {
+    return shared_ptr<T, Policy>(r, const_cast<T*>(r.get()));
+}
+
 } // namespace simple_stl
 
 
@@ -113,9 +580,10 @@ public:
 /**
  * @note: shared_ptr四个缺点
  * ① 菱形引用导致计数无法清空，导致内存泄漏问题 --> 使用 weak_ptr()
- * ② 多个shared_ptr管理同一个裸指针 shared_ptr<T> shared_ptr_name(raw_ptr)，可能导致悬垂指针 
+ * ② 多个shared_ptr管理同一个裸指针 shared_ptr<T> shared_ptr_name(raw_ptr)，可能导致悬垂指针
  * --> 使用 make_shared()
- * ③ 从shared_ptr中取出原始指针或引用，并长期保存传递它时，要确保原始指针在此期间不被销毁 
+ * ③ 从shared_ptr中取出原始指针或引用，并长期保存传递它时，要确保原始指针在此期间不被销毁
  * --> 一直保持传递智能指针/ 在传入后备份保持至少有一个shared_ptr实例在别名引用期间存活
  * ④ 不适用于高性能、实时性系统
- */
\ No newline at end of file
+ * @note make_shared 的代价：对象和控制块在同一块内存上，只要还有 weak_ptr，对象析构后这块内存也不能归还
+ */
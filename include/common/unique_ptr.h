@@ -0,0 +1,199 @@
+/**
+ * @brief 独占所有权的智能指针：不可拷贝，只能移动，析构时用删除器销毁对象
+ * 内部是 compressed_pair<T*, Deleter>：无状态删除器（default_delete、无捕获 lambda）借助空基类优化不占空间，
+ * unique_ptr<T> 与裸指针一样大，也没有 shared_ptr 的控制块和原子计数
+ *   unique_ptr<T, D>   —— 单个对象，支持 * 和 ->，可以转换为 unique_ptr<Base, ...>
+ *   unique_ptr<T[], D> —— 数组，支持 []，默认删除器用 delete[]
+ *   make_unique<T>(args...) / make_unique<T[]>(n)
+ */
+#ifndef SIMPLE_STL_COMMON_UNIQUE_PTR_H
+#define SIMPLE_STL_COMMON_UNIQUE_PTR_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "common/utilities.h" // default_delete, compressed_pair
+
+namespace simple_stl {
+
+template <typename T, typename Deleter = default_delete<T>>
+class unique_ptr
+{
+public:
+    using pointer = T*;
+    using element_type = T;
+    using deleter_type = Deleter;
+
+    constexpr unique_ptr() noexcept : pair_() {}
+    constexpr unique_ptr(std::nullptr_t) noexcept : pair_() {}
+    explicit unique_ptr(pointer p) noexcept : pair_(p, Deleter()) {}
+    unique_ptr(pointer p, const Deleter& d) : pair_(p, d) {}
+    unique_ptr(pointer p, Deleter&& d) noexcept : pair_(p, std::move(d)) {}
+
+    unique_ptr(const unique_ptr&) = delete;
+    unique_ptr& operator=(const unique_ptr&) = delete;
+
+    unique_ptr(unique_ptr&& other) noexcept : pair_(other.release(), std::move(other.get_deleter())) {}
+
+    // unique_ptr<Derived> -> unique_ptr<Base>：指针和删除器都要能转换，数组不参与
+    template <typename U, typename E, typename = typename std::enable_if<
+        !std::is_array<U>::value &&
+        std::is_convertible<U*, T*>::value &&
+        std::is_convertible<E, Deleter>::value>::type>
+    unique_ptr(unique_ptr<U, E>&& other) noexcept : pair_(other.release(), std::move(other.get_deleter())) {}
+
+    ~unique_ptr() {
+        if(get()) get_deleter()(get());
+    }
+
+    unique_ptr& operator=(unique_ptr&& other) noexcept {
+        reset(other.release());
+        get_deleter() = std::move(other.get_deleter());
+        return *this;
+    }
+
+    template <typename U, typename E, typename = typename std::enable_if<
+        !std::is_array<U>::value &&
+        std::is_convertible<U*, T*>::value &&
+        std::is_assignable<Deleter&, E&&>::value>::type>
+    unique_ptr& operator=(unique_ptr<U, E>&& other) noexcept {
+        reset(other.release());
+        get_deleter() = std::move(other.get_deleter());
+        return *this;
+    }
+
+    unique_ptr& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    // 放弃所有权并返回裸指针，由调用方负责释放
+    pointer release() noexcept {
+        pointer p = get();
+        pair_.first() = nullptr;
+        return p;
+    }
+
+    // 先换上新指针再删除旧对象：旧对象的析构函数里即使再访问本 unique_ptr 也不会重复删除
+    void reset(pointer p = nullptr) noexcept {
+        pointer old = get();
+        pair_.first() = p;
+        if(old) get_deleter()(old);
+    }
+
+    void swap(unique_ptr& other) noexcept { pair_.swap(other.pair_); }
+
+    pointer get() const noexcept { return pair_.first(); }
+    Deleter& get_deleter() noexcept { return pair_.second(); }
+    const Deleter& get_deleter() const noexcept { return pair_.second(); }
+    explicit operator bool() const noexcept { return get() != nullptr; }
+
+    typename std::add_lvalue_reference<T>::type operator*() const { return *get(); }
+    pointer operator->() const noexcept { return get(); }
+
+private:
+    compressed_pair<pointer, Deleter> pair_;
+};
+
+// 数组版本：不能转换为基类数组（元素大小不同，按基类下标访问会错位）
+template <typename T, typename Deleter>
+class unique_ptr<T[], Deleter>
+{
+public:
+    using pointer = T*;
+    using element_type = T;
+    using deleter_type = Deleter;
+
+    constexpr unique_ptr() noexcept : pair_() {}
+    constexpr unique_ptr(std::nullptr_t) noexcept : pair_() {}
+    explicit unique_ptr(pointer p) noexcept : pair_(p, Deleter()) {}
+    unique_ptr(pointer p, const Deleter& d) : pair_(p, d) {}
+    unique_ptr(pointer p, Deleter&& d) noexcept : pair_(p, std::move(d)) {}
+
+    unique_ptr(const unique_ptr&) = delete;
+    unique_ptr& operator=(const unique_ptr&) = delete;
+
+    unique_ptr(unique_ptr&& other) noexcept : pair_(other.release(), std::move(other.get_deleter())) {}
+
+    ~unique_ptr() {
+        if(get()) get_deleter()(get());
+    }
+
+    unique_ptr& operator=(unique_ptr&& other) noexcept {
+        reset(other.release());
+        get_deleter() = std::move(other.get_deleter());
+        return *this;
+    }
+
+    unique_ptr& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    pointer release() noexcept {
+        pointer p = get();
+        pair_.first() = nullptr;
+        return p;
+    }
+
+    void reset(pointer p = nullptr) noexcept {
+        pointer old = get();
+        pair_.first() = p;
+        if(old) get_deleter()(old);
+    }
+
+    void swap(unique_ptr& other) noexcept { pair_.swap(other.pair_); }
+
+    pointer get() const noexcept { return pair_.first(); }
+    Deleter& get_deleter() noexcept { return pair_.second(); }
+    const Deleter& get_deleter() const noexcept { return pair_.second(); }
+    explicit operator bool() const noexcept { return get() != nullptr; }
+
+    T& operator[](std::size_t i) const { return get()[i]; }
+
+private:
+    compressed_pair<pointer, Deleter> pair_;
+};
+
+template <typename T1, typename D1, typename T2, typename D2>
+bool operator==(const unique_ptr<T1, D1>& a, const unique_ptr<T2, D2>& b) noexcept { return a.get() == b.get(); }
+template <typename T1, typename D1, typename T2, typename D2>
+bool operator!=(const unique_ptr<T1, D1>& a, const unique_ptr<T2, D2>& b) noexcept { return a.get() != b.get(); }
+template <typename T1, typename D1, typename T2, typename D2>
+bool operator<(const unique_ptr<T1, D1>& a, const unique_ptr<T2, D2>& b) noexcept { return a.get() < b.get(); }
+template <typename T, typename D>
+bool operator==(const unique_ptr<T, D>& a, std::nullptr_t) noexcept { return !a; }
+template <typename T, typename D>
+bool operator!=(const unique_ptr<T, D>& a, std::nullptr_t) noexcept { return static_cast<bool>(a); }
+
+template <typename T, typename D>
+void swap(unique_ptr<T, D>& a, unique_ptr<T, D>& b) noexcept { a.swap(b); }
+
+// 单个对象
+template <typename T, typename... Args>
+typename std::enable_if<!std::is_array<T>::value, unique_ptr<T>>::type
+make_unique(Args&&... args) {
+    return unique_ptr<T>(new T(std::forward<Args>(args)...));
+}
+
+// 长度在运行时确定的数组，元素值初始化（内置类型为0）
+template <typename T>
+typename std::enable_if<std::is_array<T>::value && std::extent<T>::value == 0, unique_ptr<T>>::type
+make_unique(std::size_t n) {
+    using U = typename std::remove_extent<T>::type;
+    return unique_ptr<T>(new U[n]());
+}
+
+// 定长数组 T[N] 不支持
+template <typename T, typename... Args>
+typename std::enable_if<std::extent<T>::value != 0>::type
+make_unique(Args&&...) = delete;
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_COMMON_UNIQUE_PTR_H
+
+/**
+ * @note 需要共享时可以直接把 unique_ptr 移动给 shared_ptr（见 shared_ptr(unique_ptr<Y, D>&&)），
+ * 独占所有权是默认选择，只有确实存在多个所有者时才升级为 shared_ptr
+ */
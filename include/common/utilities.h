@@ -4,11 +4,103 @@
 
 #include <cstddef> // for std::size_t
 #include <type_traits>
+#include <utility> // forward, swap
+
+#include "common/iterator.h" // iterator_traits
 
  
 
 namespace simple_stl {
 
+// 标记：调用方保证输入区间已按键有序且无重复，有序容器可以跳过排序直接批量构建（flat_map、btree_map 共用）
+struct sorted_unique_t { explicit sorted_unique_t() = default; };
+inline constexpr sorted_unique_t sorted_unique{};
+
+/*    ********************** 默认删除器 **********************     */
+
+// 智能指针的默认删除器：单个对象用 delete，数组用 delete[]；无状态，配合空基类优化不占空间
+template <typename T>
+struct default_delete
+{
+    constexpr default_delete() noexcept = default;
+    // 允许 default_delete<Derived> 转换为 default_delete<Base>
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    default_delete(const default_delete<U>&) noexcept {}
+
+    void operator()(T* p) const {
+        static_assert(sizeof(T) > 0, "can't delete pointer to incomplete type");
+        delete p;
+    }
+};
+
+template <typename T>
+struct default_delete<T[]>
+{
+    constexpr default_delete() noexcept = default;
+
+    void operator()(T* p) const {
+        static_assert(sizeof(T) > 0, "can't delete pointer to incomplete type");
+        delete[] p;
+    }
+};
+
+/*    ********************** 压缩对（空基类优化） **********************     */
+
+// 空类型且不是 final 时以私有基类的方式存放（空基类不占空间），否则作为普通成员；Index 区分两个相同类型的成员
+template <typename T, int Index, bool = std::is_empty<T>::value && !std::is_final<T>::value>
+class ebo_storage
+{
+public:
+    constexpr ebo_storage() : value_() {}
+    template <typename U>
+    constexpr explicit ebo_storage(U&& v) : value_(std::forward<U>(v)) {}
+
+    T& get() noexcept { return value_; }
+    const T& get() const noexcept { return value_; }
+
+private:
+    T value_;
+};
+
+template <typename T, int Index>
+class ebo_storage<T, Index, true> : private T
+{
+public:
+    constexpr ebo_storage() : T() {}
+    template <typename U>
+    constexpr explicit ebo_storage(U&& v) : T(std::forward<U>(v)) {}
+
+    T& get() noexcept { return *this; }
+    const T& get() const noexcept { return *this; }
+};
+
+/**
+ * @brief 两个成员的组合，空的成员（无状态删除器、分配器、比较器）不占空间
+ * 例如 unique_ptr<T> 内部是 compressed_pair<T*, default_delete<T>>，sizeof 与裸指针相同
+ */
+template <typename T1, typename T2>
+class compressed_pair : private ebo_storage<T1, 0>, private ebo_storage<T2, 1>
+{
+    using First = ebo_storage<T1, 0>;
+    using Second = ebo_storage<T2, 1>;
+
+public:
+    constexpr compressed_pair() : First(), Second() {}
+    template <typename U1, typename U2>
+    constexpr compressed_pair(U1&& a, U2&& b) : First(std::forward<U1>(a)), Second(std::forward<U2>(b)) {}
+
+    T1& first() noexcept { return First::get(); }
+    const T1& first() const noexcept { return First::get(); }
+    T2& second() noexcept { return Second::get(); }
+    const T2& second() const noexcept { return Second::get(); }
+
+    void swap(compressed_pair& other) {
+        using std::swap;
+        swap(first(), other.first());
+        swap(second(), other.second());
+    }
+};
+
 /*    ********************** 内存操作工具 **********************     */
 
 // uninitialized_move（未初始化内存移动）： 在已分配内存地址的情况下，使用移动构造将旧内存地址上的对象移动到新地址上
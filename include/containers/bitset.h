@@ -0,0 +1,466 @@
+/**
+ * @brief 位集合：定长的 bitset<N> 与可变长的 dynamic_bitset，都以64位字为单位存储
+ * 集合运算 and/or/xor/andnot 逐字进行（一次处理64个元素，循环简单，编译器可以进一步向量化）
+ * count 使用硬件 popcount，find_first/find_next 使用 ctz（tzcnt）跳过整段为0的字
+ * rank(pos)：[0, pos) 中置位的个数；select(k)：第 k 个（从0开始）置位的位置
+ *   dynamic_bitset 可以调用 build_rank_index() 建立每512位一个的前缀计数，之后 rank 为 O(1)、select 为 O(log n)；
+ *   任何修改都会使索引失效，此时 rank/select 退回到逐字 popcount 扫描
+ * @note 不变式：最后一个字中超出 size() 的高位恒为0，count/find/比较都依赖这一点
+ */
+#ifndef SIMPLE_STL_CONTAINERS_BITSET_H
+#define SIMPLE_STL_CONTAINERS_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "containers/vector.h"
+
+namespace simple_stl {
+
+namespace bit_detail {
+
+using word_type = std::uint64_t;
+constexpr std::size_t word_bits = 64;
+constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+constexpr std::size_t words_for(std::size_t nbits) noexcept { return (nbits + word_bits - 1) / word_bits; }
+
+// 最后一个字的有效位掩码，nbits 是64的倍数时为全1
+constexpr word_type tail_mask(std::size_t nbits) noexcept {
+    return nbits % word_bits ? (word_type(1) << (nbits % word_bits)) - 1 : ~word_type(0);
+}
+
+inline int popcount(word_type w) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(w);
+#else
+    w = w - ((w >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return static_cast<int>((w * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// 最低置位的下标，w 不能为0
+inline int ctz(word_type w) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(w);
+#else
+    int n = 0;
+    while(!(w & 1)){
+        w >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+// 字内第 k 个置位的下标（k < popcount(w)）；有 BMI2 时 pdep 把 1<<k 分散到 w 的第 k 个置位上
+inline int select_in_word(word_type w, unsigned k) noexcept {
+#if defined(__BMI2__)
+    return ctz(_pdep_u64(word_type(1) << k, w));
+#else
+    for(unsigned i = 0; i < k; ++i) w &= w - 1; // 逐个清掉最低置位
+    return ctz(w);
+#endif
+}
+
+inline std::size_t count(const word_type* words, std::size_t nwords) noexcept {
+    std::size_t n = 0;
+    for(std::size_t i = 0; i < nwords; ++i) n += popcount(words[i]);
+    return n;
+}
+
+// 从 pos（含）开始的第一个置位，没有则返回 npos
+inline std::size_t find_from(const word_type* words, std::size_t nwords, std::size_t pos) noexcept {
+    std::size_t i = pos / word_bits;
+    if(i >= nwords) return npos;
+    word_type w = words[i] & (~word_type(0) << (pos % word_bits));
+    while(!w){
+        if(++i == nwords) return npos;
+        w = words[i];
+    }
+    return i * word_bits + ctz(w);
+}
+
+// [0, pos) 中置位的个数
+inline std::size_t rank(const word_type* words, std::size_t pos) noexcept {
+    std::size_t full = pos / word_bits;
+    std::size_t n = count(words, full);
+    if(pos % word_bits) n += popcount(words[full] & tail_mask(pos));
+    return n;
+}
+
+// 从第 first 个字开始，前面已经数过 seen 个置位，找第 k 个置位
+inline std::size_t select_from(const word_type* words, std::size_t nwords, std::size_t first, std::size_t seen, std::size_t k) noexcept {
+    for(std::size_t i = first; i < nwords; ++i){
+        std::size_t c = popcount(words[i]);
+        if(seen + c > k) return i * word_bits + select_in_word(words[i], static_cast<unsigned>(k - seen));
+        seen += c;
+    }
+    return npos;
+}
+
+inline bool equal(const word_type* a, const word_type* b, std::size_t nwords) noexcept {
+    for(std::size_t i = 0; i < nwords; ++i){
+        if(a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+inline std::string to_string(const word_type* words, std::size_t nbits) {
+    std::string s(nbits, '0');
+    for(std::size_t i = 0; i < nbits; ++i){
+        if(words[i / word_bits] >> (i % word_bits) & 1) s[nbits - 1 - i] = '1'; // 与 std::bitset 一致，最高位在左
+    }
+    return s;
+}
+
+} // namespace bit_detail
+
+template <std::size_t N>
+class bitset
+{
+    static_assert(N > 0, "bitset<0> is not supported");
+
+public:
+    using size_type = std::size_t;
+    using word_type = bit_detail::word_type;
+    static constexpr size_type npos = bit_detail::npos;
+    static constexpr size_type num_words = bit_detail::words_for(N);
+
+    constexpr bitset() noexcept : words_{} {}
+    // 低64位由 value 初始化
+    bitset(unsigned long long value) noexcept : words_{} {
+        words_[0] = value;
+        trim();
+    }
+
+    constexpr size_type size() const noexcept { return N; }
+
+    bool operator[](size_type pos) const noexcept { return words_[pos / 64] >> (pos % 64) & 1; }
+    bool test(size_type pos) const {
+        check(pos, "bitset::test");
+        return (*this)[pos];
+    }
+
+    bitset& set() noexcept {
+        for(word_type& w : words_) w = ~word_type(0);
+        trim();
+        return *this;
+    }
+    bitset& set(size_type pos, bool value = true) {
+        check(pos, "bitset::set");
+        word_type bit = word_type(1) << (pos % 64);
+        if(value) words_[pos / 64] |= bit;
+        else words_[pos / 64] &= ~bit;
+        return *this;
+    }
+    bitset& reset() noexcept {
+        for(word_type& w : words_) w = 0;
+        return *this;
+    }
+    bitset& reset(size_type pos) { return set(pos, false); }
+    bitset& flip() noexcept {
+        for(word_type& w : words_) w = ~w;
+        trim();
+        return *this;
+    }
+    bitset& flip(size_type pos) {
+        check(pos, "bitset::flip");
+        words_[pos / 64] ^= word_type(1) << (pos % 64);
+        return *this;
+    }
+
+    size_type count() const noexcept { return bit_detail::count(words_, num_words); }
+    bool any() const noexcept {
+        for(word_type w : words_){
+            if(w) return true;
+        }
+        return false;
+    }
+    bool none() const noexcept { return !any(); }
+    bool all() const noexcept { return count() == N; }
+
+    bitset& operator&=(const bitset& other) noexcept {
+        for(size_type i = 0; i < num_words; ++i) words_[i] &= other.words_[i];
+        return *this;
+    }
+    bitset& operator|=(const bitset& other) noexcept {
+        for(size_type i = 0; i < num_words; ++i) words_[i] |= other.words_[i];
+        return *this;
+    }
+    bitset& operator^=(const bitset& other) noexcept {
+        for(size_type i = 0; i < num_words; ++i) words_[i] ^= other.words_[i];
+        return *this;
+    }
+    // 差集：this & ~other，不必先构造出 ~other
+    bitset& and_not(const bitset& other) noexcept {
+        for(size_type i = 0; i < num_words; ++i) words_[i] &= ~other.words_[i];
+        return *this;
+    }
+    bitset operator~() const noexcept { return bitset(*this).flip(); }
+
+    friend bitset operator&(bitset a, const bitset& b) noexcept { return a &= b; }
+    friend bitset operator|(bitset a, const bitset& b) noexcept { return a |= b; }
+    friend bitset operator^(bitset a, const bitset& b) noexcept { return a ^= b; }
+    friend bool operator==(const bitset& a, const bitset& b) noexcept { return bit_detail::equal(a.words_, b.words_, num_words); }
+    friend bool operator!=(const bitset& a, const bitset& b) noexcept { return !(a == b); }
+
+    // 遍历所有置位：for(i = find_first(); i != npos; i = find_next(i))
+    size_type find_first() const noexcept { return bit_detail::find_from(words_, num_words, 0); }
+    size_type find_next(size_type prev) const noexcept {
+        return prev + 1 >= N ? npos : bit_detail::find_from(words_, num_words, prev + 1);
+    }
+
+    size_type rank(size_type pos) const noexcept { return bit_detail::rank(words_, pos < N ? pos : N); }
+    size_type select(size_type k) const noexcept { return bit_detail::select_from(words_, num_words, 0, 0, k); }
+
+    std::string to_string() const { return bit_detail::to_string(words_, N); }
+
+    const word_type* data() const noexcept { return words_; }
+
+private:
+    word_type words_[num_words];
+
+    void trim() noexcept { words_[num_words - 1] &= bit_detail::tail_mask(N); }
+
+    static void check(size_type pos, const char* what) {
+        if(pos >= N){
+            throw std::out_of_range(what);
+        }
+    }
+};
+
+template <typename Allocator = simple_stl::allocator<std::uint64_t>>
+class dynamic_bitset
+{
+public:
+    using size_type = std::size_t;
+    using word_type = bit_detail::word_type;
+    using allocator_type = Allocator;
+    static constexpr size_type npos = bit_detail::npos;
+    // rank 索引的粒度：每个超级块8个字（512位，正好一条64字节缓存行）
+    static constexpr size_type words_per_block = 8;
+
+    dynamic_bitset() : nbits_(0), rank_valid_(false) {}
+    explicit dynamic_bitset(size_type nbits, bool value = false) : nbits_(0), rank_valid_(false) { resize(nbits, value); }
+
+    size_type size() const noexcept { return nbits_; }
+    size_type num_words() const noexcept { return words_.size(); }
+    bool empty() const noexcept { return nbits_ == 0; }
+
+    // 新增的位取 value
+    void resize(size_type nbits, bool value = false) {
+        size_type old_bits = nbits_;
+        if(value && nbits > old_bits && old_bits % 64){
+            words_[old_bits / 64] |= ~bit_detail::tail_mask(old_bits); // 先把旧的最后一个字的空闲高位补1
+        }
+        words_.resize(bit_detail::words_for(nbits), value ? ~word_type(0) : word_type(0));
+        nbits_ = nbits;
+        trim();
+        rank_valid_ = false;
+    }
+    void push_back(bool value) {
+        if(nbits_ % 64 == 0) words_.push_back(0);
+        if(value) words_[nbits_ / 64] |= word_type(1) << (nbits_ % 64);
+        ++nbits_;
+        rank_valid_ = false;
+    }
+    void clear() noexcept {
+        words_.clear();
+        nbits_ = 0;
+        rank_valid_ = false;
+    }
+
+    bool operator[](size_type pos) const noexcept { return words_[pos / 64] >> (pos % 64) & 1; }
+    bool test(size_type pos) const {
+        check(pos, "dynamic_bitset::test");
+        return (*this)[pos];
+    }
+
+    dynamic_bitset& set() noexcept {
+        for(word_type& w : words_) w = ~word_type(0);
+        trim();
+        rank_valid_ = false;
+        return *this;
+    }
+    dynamic_bitset& set(size_type pos, bool value = true) {
+        check(pos, "dynamic_bitset::set");
+        word_type bit = word_type(1) << (pos % 64);
+        if(value) words_[pos / 64] |= bit;
+        else words_[pos / 64] &= ~bit;
+        rank_valid_ = false;
+        return *this;
+    }
+    dynamic_bitset& reset() noexcept {
+        for(word_type& w : words_) w = 0;
+        rank_valid_ = false;
+        return *this;
+    }
+    dynamic_bitset& reset(size_type pos) { return set(pos, false); }
+    dynamic_bitset& flip() noexcept {
+        for(word_type& w : words_) w = ~w;
+        trim();
+        rank_valid_ = false;
+        return *this;
+    }
+    dynamic_bitset& flip(size_type pos) {
+        check(pos, "dynamic_bitset::flip");
+        words_[pos / 64] ^= word_type(1) << (pos % 64);
+        rank_valid_ = false;
+        return *this;
+    }
+
+    size_type count() const noexcept { return bit_detail::count(words_.data(), words_.size()); }
+    bool any() const noexcept {
+        for(word_type w : words_){
+            if(w) return true;
+        }
+        return false;
+    }
+    bool none() const noexcept { return !any(); }
+    bool all() const noexcept { return count() == nbits_; }
+
+    /*    ********************** 集合运算（两边长度必须相同） **********************     */
+    dynamic_bitset& operator&=(const dynamic_bitset& other) {
+        const word_type* src = same_size(other, "dynamic_bitset::operator&=");
+        word_type* dst = words_.data();
+        for(size_type i = 0, n = words_.size(); i < n; ++i) dst[i] &= src[i];
+        rank_valid_ = false;
+        return *this;
+    }
+    dynamic_bitset& operator|=(const dynamic_bitset& other) {
+        const word_type* src = same_size(other, "dynamic_bitset::operator|=");
+        word_type* dst = words_.data();
+        for(size_type i = 0, n = words_.size(); i < n; ++i) dst[i] |= src[i];
+        rank_valid_ = false;
+        return *this;
+    }
+    dynamic_bitset& operator^=(const dynamic_bitset& other) {
+        const word_type* src = same_size(other, "dynamic_bitset::operator^=");
+        word_type* dst = words_.data();
+        for(size_type i = 0, n = words_.size(); i < n; ++i) dst[i] ^= src[i];
+        rank_valid_ = false;
+        return *this;
+    }
+    dynamic_bitset& and_not(const dynamic_bitset& other) {
+        const word_type* src = same_size(other, "dynamic_bitset::and_not");
+        word_type* dst = words_.data();
+        for(size_type i = 0, n = words_.size(); i < n; ++i) dst[i] &= ~src[i];
+        rank_valid_ = false;
+        return *this;
+    }
+    dynamic_bitset operator~() const { return dynamic_bitset(*this).flip(); }
+
+    friend dynamic_bitset operator&(dynamic_bitset a, const dynamic_bitset& b) { return a &= b; }
+    friend dynamic_bitset operator|(dynamic_bitset a, const dynamic_bitset& b) { return a |= b; }
+    friend dynamic_bitset operator^(dynamic_bitset a, const dynamic_bitset& b) { return a ^= b; }
+    friend bool operator==(const dynamic_bitset& a, const dynamic_bitset& b) noexcept {
+        return a.nbits_ == b.nbits_ && bit_detail::equal(a.words_.data(), b.words_.data(), a.words_.size());
+    }
+    friend bool operator!=(const dynamic_bitset& a, const dynamic_bitset& b) noexcept { return !(a == b); }
+
+    // |this & other|，只统计交集大小而不生成中间结果
+    size_type count_and(const dynamic_bitset& other) const {
+        const word_type* src = same_size(other, "dynamic_bitset::count_and");
+        const word_type* w = words_.data();
+        size_type n = 0;
+        for(size_type i = 0, nw = words_.size(); i < nw; ++i) n += bit_detail::popcount(w[i] & src[i]);
+        return n;
+    }
+
+    size_type find_first() const noexcept { return bit_detail::find_from(words_.data(), words_.size(), 0); }
+    size_type find_next(size_type prev) const noexcept {
+        return prev + 1 >= nbits_ ? npos : bit_detail::find_from(words_.data(), words_.size(), prev + 1);
+    }
+
+    /*    ********************** rank / select **********************     */
+    // blocks_[j] = 前 j 个超级块中置位的总数
+    void build_rank_index() {
+        size_type nblocks = (words_.size() + words_per_block - 1) / words_per_block;
+        blocks_.resize(nblocks + 1);
+        size_type total = 0;
+        for(size_type j = 0; j < nblocks; ++j){
+            blocks_[j] = total;
+            size_type first = j * words_per_block;
+            size_type n = words_.size() - first < words_per_block ? words_.size() - first : words_per_block;
+            total += bit_detail::count(words_.data() + first, n);
+        }
+        blocks_[nblocks] = total;
+        rank_valid_ = true;
+    }
+    bool has_rank_index() const noexcept { return rank_valid_; }
+
+    size_type rank(size_type pos) const noexcept {
+        if(pos > nbits_) pos = nbits_;
+        if(!rank_valid_) return bit_detail::rank(words_.data(), pos);
+        size_type block = pos / (64 * words_per_block);
+        size_type first = block * words_per_block;
+        size_type bit = pos - first * 64;
+        return blocks_[block] + bit_detail::rank(words_.data() + first, bit);
+    }
+
+    size_type select(size_type k) const noexcept {
+        if(!rank_valid_) return bit_detail::select_from(words_.data(), words_.size(), 0, 0, k);
+        size_type nblocks = blocks_.size() - 1;
+        if(k >= blocks_[nblocks]) return npos;
+        // 二分找到最后一个 blocks_[j] <= k 的超级块，再在块内最多扫描8个字
+        size_type lo = 0, hi = nblocks;
+        while(hi - lo > 1){
+            size_type mid = lo + (hi - lo) / 2;
+            if(blocks_[mid] <= k) lo = mid;
+            else hi = mid;
+        }
+        return bit_detail::select_from(words_.data(), words_.size(), lo * words_per_block, blocks_[lo], k);
+    }
+
+    std::string to_string() const { return bit_detail::to_string(words_.data(), nbits_); }
+
+    const word_type* data() const noexcept { return words_.data(); }
+
+    void swap(dynamic_bitset& other) noexcept {
+        words_.swap(other.words_);
+        blocks_.swap(other.blocks_);
+        std::swap(nbits_, other.nbits_);
+        std::swap(rank_valid_, other.rank_valid_);
+    }
+
+private:
+    simple_stl::vector<word_type, Allocator> words_;
+    simple_stl::vector<size_type> blocks_; // rank 索引
+    size_type nbits_;
+    bool rank_valid_;
+
+    void trim() noexcept {
+        if(!words_.empty()) words_.back() &= bit_detail::tail_mask(nbits_);
+    }
+
+    void check(size_type pos, const char* what) const {
+        if(pos >= nbits_){
+            throw std::out_of_range(what);
+        }
+    }
+
+    const word_type* same_size(const dynamic_bitset& other, const char* what) const {
+        if(other.nbits_ != nbits_){
+            throw std::invalid_argument(what);
+        }
+        return other.words_.data();
+    }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_BITSET_H
+
+/**
+ * @note 与 vector<bool> 的对比：按字运算时一条指令处理64个元素，100万个 id 的集合只占 125KB，
+ * 交集/并集的吞吐取决于内存带宽，而不是逐元素的分支
+ * @note 没有提供 operator[] 的可写代理引用，写入统一通过 set/reset/flip，这样 rank 索引的失效点是明确的
+ */
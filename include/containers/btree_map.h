@@ -0,0 +1,892 @@
+/**
+ * @brief B+ 树有序映射：每个节点是一块固定大小（默认256字节，即4条缓存行）的宽节点，
+ * 内部节点只存键和孩子指针，元素全部存放在叶子中，叶子之间用双向链表串起来
+ * 与红黑树（std::map）的对比：
+ *   查找：红黑树每层一次缓存未命中、层数约 log2(n)；B+ 树每层在一个节点内二分，层数约 log_B(n)，千万级元素通常只有 4~5 层
+ *   内存：红黑树每元素一个节点（3个指针 + 颜色 + 堆分配头）；B+ 树叶子直接连续存放元素，只有节点头和未填满的空槽是额外开销
+ *   范围扫描：沿叶子链表线性扫描，不需要像红黑树那样回溯父节点
+ * 插入：叶子满时分裂，分隔键上推到父节点，父节点满时继续分裂；向最右叶子的末尾追加时不对半分裂，保证顺序插入时叶子是满的
+ * 删除：节点元素少于一半时先向兄弟借一个，兄弟也不富余时与兄弟合并，并从父节点删除对应的分隔键
+ * bulk_load / btree_map(sorted_unique, first, last)：对有序输入自底向上逐层构建，O(n)，所有节点尽量填满
+ * @note 插入和删除都可能在节点之间搬移元素，会使所有迭代器和元素引用失效
+ */
+#ifndef SIMPLE_STL_CONTAINERS_BTREE_MAP_H
+#define SIMPLE_STL_CONTAINERS_BTREE_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/allocator.h"
+#include "common/iterator.h"
+#include "common/utilities.h"
+#include "containers/vector.h"
+
+namespace simple_stl {
+
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = simple_stl::allocator<std::pair<const Key, T>>, std::size_t NodeBytes = 256>
+class btree_map
+{
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    struct NodeBase {
+        unsigned short count; // 叶子：元素个数；内部节点：键的个数（孩子数 = count + 1）
+        bool is_leaf;
+
+        explicit NodeBase(bool leaf) noexcept : count(0), is_leaf(leaf) {}
+    };
+
+    struct LeafHeader : NodeBase {
+        LeafHeader* prev;
+        LeafHeader* next;
+
+        LeafHeader() noexcept : NodeBase(true), prev(nullptr), next(nullptr) {}
+    };
+
+    static constexpr std::size_t max_of(std::size_t a, std::size_t b) { return a > b ? a : b; }
+
+public:
+    // 节点容量由 NodeBytes 反推，至少为3以保证分裂/合并的前提成立
+    static constexpr std::size_t leaf_capacity =
+        max_of(3, NodeBytes > sizeof(LeafHeader) ? (NodeBytes - sizeof(LeafHeader)) / sizeof(value_type) : 0);
+    static constexpr std::size_t internal_capacity =
+        max_of(3, NodeBytes > sizeof(NodeBase) + 2 * sizeof(void*)
+                      ? (NodeBytes - sizeof(NodeBase) - 2 * sizeof(void*)) / (sizeof(Key) + sizeof(void*)) : 0);
+
+private:
+    static constexpr std::size_t leaf_min = leaf_capacity / 2;
+    static constexpr std::size_t internal_min = (internal_capacity - 1) / 2;
+    static constexpr int max_height = 64;
+
+    struct LeafNode : LeafHeader {
+        alignas(value_type) unsigned char storage[leaf_capacity * sizeof(value_type)];
+
+        value_type* slots() noexcept { return reinterpret_cast<value_type*>(storage); }
+    };
+
+    // 多留一个键和一个孩子的位置：先插入再判断是否需要分裂，分裂逻辑不必处理“待插入的那一项”
+    struct InternalNode : NodeBase {
+        alignas(Key) unsigned char storage[(internal_capacity + 1) * sizeof(Key)];
+        NodeBase* children[internal_capacity + 2];
+
+        InternalNode() noexcept : NodeBase(false) {}
+
+        Key* keys() noexcept { return reinterpret_cast<Key*>(storage); }
+    };
+
+    using LeafAllocator = typename Allocator::template rebind<LeafNode>::other;
+    using InternalAllocator = typename Allocator::template rebind<InternalNode>::other;
+    using KeyAllocator = typename Allocator::template rebind<Key>::other;
+
+    // 从根到叶子的路径：nodes[i] 是第 i 层的内部节点，index[i] 是走向的孩子下标
+    struct Path {
+        InternalNode* nodes[max_height];
+        size_type index[max_height];
+        int depth = 0;
+    };
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = simple_stl::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<const Key, T>;
+        using pointer = typename std::conditional<Const, const value_type*, value_type*>::type;
+        using reference = typename std::conditional<Const, const value_type&, value_type&>::type;
+
+        Iterator() noexcept : leaf_(nullptr), index_(0) {}
+        // 普通迭代器可以隐式转换为常量迭代器
+        template <bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false>& other) noexcept : leaf_(other.leaf_), index_(other.index_) {}
+
+        reference operator*() const noexcept { return static_cast<LeafNode*>(leaf_)->slots()[index_]; }
+        pointer operator->() const noexcept { return static_cast<LeafNode*>(leaf_)->slots() + index_; }
+
+        // 末尾叶子的 (leaf, count) 即 end()，因此走到最后一个叶子末尾时停在原地
+        Iterator& operator++() noexcept {
+            if(++index_ == leaf_->count && leaf_->next){
+                leaf_ = leaf_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+        Iterator operator++(int) noexcept {
+            Iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+        Iterator& operator--() noexcept {
+            if(index_ == 0){
+                leaf_ = leaf_->prev;
+                index_ = leaf_->count;
+            }
+            --index_;
+            return *this;
+        }
+        Iterator operator--(int) noexcept {
+            Iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+            return a.leaf_ == b.leaf_ && a.index_ == b.index_;
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return !(a == b); }
+
+    private:
+        friend class btree_map;
+        template <bool> friend class Iterator;
+
+        Iterator(LeafHeader* leaf, size_type index) noexcept : leaf_(leaf), index_(index) {}
+
+        LeafHeader* leaf_;
+        size_type index_;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = simple_stl::reverse_iterator<iterator>;
+    using const_reverse_iterator = simple_stl::reverse_iterator<const_iterator>;
+
+    btree_map() : btree_map(Compare()) {}
+
+    explicit btree_map(const Compare& comp, const Allocator& alloc = Allocator())
+        : root_(nullptr), leftmost_(nullptr), rightmost_(nullptr), size_(0), comp_(comp),
+          leaf_alloc_(alloc), internal_alloc_(alloc), key_alloc_(alloc) {}
+
+    template <typename InputIt>
+    btree_map(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : btree_map(comp, alloc) {
+        insert(first, last);
+    }
+
+    template <typename ForwardIt>
+    btree_map(sorted_unique_t, ForwardIt first, ForwardIt last, const Compare& comp = Compare(),
+              const Allocator& alloc = Allocator())
+        : btree_map(comp, alloc) {
+        bulk_load(first, last);
+    }
+
+    btree_map(std::initializer_list<value_type> ilist, const Compare& comp = Compare(),
+              const Allocator& alloc = Allocator())
+        : btree_map(comp, alloc) {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    // 源树的遍历结果天然有序，直接批量构建，比逐个插入快且节点是满的
+    btree_map(const btree_map& other)
+        : btree_map(other.comp_, Allocator(other.leaf_alloc_)) {
+        build_sorted(other.begin(), other.end(), other.size_);
+    }
+
+    btree_map(btree_map&& other) noexcept
+        : root_(other.root_), leftmost_(other.leftmost_), rightmost_(other.rightmost_), size_(other.size_),
+          comp_(std::move(other.comp_)), leaf_alloc_(std::move(other.leaf_alloc_)),
+          internal_alloc_(std::move(other.internal_alloc_)), key_alloc_(std::move(other.key_alloc_)) {
+        other.root_ = nullptr;
+        other.leftmost_ = nullptr;
+        other.rightmost_ = nullptr;
+        other.size_ = 0;
+    }
+
+    btree_map& operator=(const btree_map& other) {
+        if(this != &other){
+            btree_map temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    btree_map& operator=(btree_map&& other) noexcept {
+        if(this != &other){
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~btree_map() { clear(); }
+
+    /*    ********************** 迭代器 **********************     */
+    iterator begin() noexcept { return iterator(leftmost_, 0); }
+    iterator end() noexcept { return iterator(rightmost_, rightmost_ ? rightmost_->count : 0); }
+    const_iterator begin() const noexcept { return const_cast<btree_map*>(this)->begin(); }
+    const_iterator end() const noexcept { return const_cast<btree_map*>(this)->end(); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /*    ********************** 容量 **********************     */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    // 树高（空树为0，只有一个叶子为1）
+    size_type height() const noexcept {
+        size_type h = 0;
+        for(NodeBase* node = root_; node; node = node->is_leaf ? nullptr : static_cast<InternalNode*>(node)->children[0]){
+            ++h;
+        }
+        return h;
+    }
+
+    key_compare key_comp() const { return comp_; }
+
+    /*    ********************** 查找 **********************     */
+    iterator lower_bound(const Key& key) {
+        if(!root_) return end();
+        LeafNode* leaf = descend(key, nullptr);
+        return normalize(leaf, leaf_lower_bound(leaf, key));
+    }
+    const_iterator lower_bound(const Key& key) const { return const_cast<btree_map*>(this)->lower_bound(key); }
+
+    iterator upper_bound(const Key& key) {
+        if(!root_) return end();
+        LeafNode* leaf = descend(key, nullptr);
+        return normalize(leaf, leaf_upper_bound(leaf, key));
+    }
+    const_iterator upper_bound(const Key& key) const { return const_cast<btree_map*>(this)->upper_bound(key); }
+
+    iterator find(const Key& key) {
+        if(!root_) return end();
+        LeafNode* leaf = descend(key, nullptr);
+        size_type pos = leaf_lower_bound(leaf, key);
+        if(pos < leaf->count && !comp_(key, leaf->slots()[pos].first)) return iterator(leaf, pos);
+        return end();
+    }
+    const_iterator find(const Key& key) const { return const_cast<btree_map*>(this)->find(key); }
+
+    bool contains(const Key& key) const { return find(key) != end(); }
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    std::pair<iterator, iterator> equal_range(const Key& key) { return {lower_bound(key), upper_bound(key)}; }
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    T& at(const Key& key) {
+        iterator it = find(key);
+        if(it == end()){
+            throw std::out_of_range("btree_map::at: key not found");
+        }
+        return it->second;
+    }
+    const T& at(const Key& key) const { return const_cast<btree_map*>(this)->at(key); }
+
+    T& operator[](const Key& key) { return try_emplace_impl(key).first->second; }
+    T& operator[](Key&& key) { return try_emplace_impl(std::move(key)).first->second; }
+
+    /*    ********************** 插入 **********************     */
+    std::pair<iterator, bool> insert(const value_type& value) { return try_emplace_impl(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace_impl(value.first, std::move(value.second));
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        for(; first != last; ++first){
+            insert(*first);
+        }
+    }
+    void insert(std::initializer_list<value_type> ilist) { insert(ilist.begin(), ilist.end()); }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(std::forward<Args>(args)...);
+        return try_emplace_impl(value.first, std::move(value.second));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return try_emplace_impl(key, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+        std::pair<iterator, bool> res = try_emplace_impl(key, std::forward<M>(obj));
+        if(!res.second) res.first->second = std::forward<M>(obj);
+        return res;
+    }
+
+    // 用有序且无重复的区间替换全部内容，自底向上构建，O(n)；输入无序或有重复键时抛出 std::invalid_argument
+    template <typename ForwardIt>
+    void bulk_load(ForwardIt first, ForwardIt last) {
+        size_type n = 0;
+        for(ForwardIt it = first, prev = first; it != last; prev = it, ++it, ++n){
+            if(n != 0 && !comp_(prev->first, it->first)){
+                throw std::invalid_argument("btree_map::bulk_load: input is not sorted and unique");
+            }
+        }
+        clear();
+        build_sorted(first, last, n);
+    }
+
+    /*    ********************** 删除 **********************     */
+    size_type erase(const Key& key) {
+        if(!root_) return 0;
+        Path path;
+        LeafNode* leaf = descend(key, &path);
+        size_type pos = leaf_lower_bound(leaf, key);
+        if(pos == leaf->count || comp_(key, leaf->slots()[pos].first)) return 0;
+        erase_from_leaf(leaf, pos);
+        rebalance_leaf(leaf, path);
+        return 1;
+    }
+
+    // 删除后节点之间可能发生借位/合并，原有迭代器全部失效，因此按下一个元素的键重新定位
+    iterator erase(const_iterator pos) {
+        const_iterator next = pos;
+        ++next;
+        if(next == end()){
+            erase(pos->first);
+            return end();
+        }
+        Key next_key = next->first;
+        erase(pos->first);
+        return lower_bound(next_key);
+    }
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        if(last == end()){
+            while(first != end()) first = erase(first);
+            return end();
+        }
+        Key last_key = last->first;
+        iterator it(first.leaf_, first.index_);
+        while(comp_(it->first, last_key)) it = erase(it);
+        return it;
+    }
+
+    void clear() noexcept {
+        if(root_) destroy_subtree(root_);
+        root_ = nullptr;
+        leftmost_ = nullptr;
+        rightmost_ = nullptr;
+        size_ = 0;
+    }
+
+    void swap(btree_map& other) noexcept {
+        std::swap(root_, other.root_);
+        std::swap(leftmost_, other.leftmost_);
+        std::swap(rightmost_, other.rightmost_);
+        std::swap(size_, other.size_);
+        std::swap(comp_, other.comp_);
+    }
+
+    friend bool operator==(const btree_map& a, const btree_map& b) {
+        if(a.size() != b.size()) return false;
+        for(const_iterator i = a.begin(), j = b.begin(); i != a.end(); ++i, ++j){
+            if(!(i->first == j->first) || !(i->second == j->second)) return false;
+        }
+        return true;
+    }
+    friend bool operator!=(const btree_map& a, const btree_map& b) { return !(a == b); }
+
+private:
+    NodeBase* root_;
+    LeafHeader* leftmost_;  // begin() 所在叶子
+    LeafHeader* rightmost_; // end() 所在叶子
+    size_type size_;
+    Compare comp_;
+    LeafAllocator leaf_alloc_;
+    InternalAllocator internal_alloc_;
+    KeyAllocator key_alloc_;
+
+    /*    ********************** 节点内查找 **********************     */
+    // 节点内的无分支二分：返回第一个满足 !(elem < key) 的下标
+    template <typename Get>
+    size_type node_lower_bound(size_type n, const Key& key, Get get) const {
+        size_type base = 0;
+        while(n > 1){
+            size_type half = n / 2;
+            base = comp_(get(base + half - 1), key) ? base + half : base;
+            n -= half;
+        }
+        return base + (n == 1 && comp_(get(base), key) ? 1 : 0);
+    }
+    // 返回第一个满足 key < elem 的下标
+    template <typename Get>
+    size_type node_upper_bound(size_type n, const Key& key, Get get) const {
+        size_type base = 0;
+        while(n > 1){
+            size_type half = n / 2;
+            base = comp_(key, get(base + half - 1)) ? base : base + half;
+            n -= half;
+        }
+        return base + (n == 1 && !comp_(key, get(base)) ? 1 : 0);
+    }
+
+    size_type leaf_lower_bound(LeafNode* leaf, const Key& key) const {
+        value_type* s = leaf->slots();
+        return node_lower_bound(leaf->count, key, [s](size_type i) -> const Key& { return s[i].first; });
+    }
+    size_type leaf_upper_bound(LeafNode* leaf, const Key& key) const {
+        value_type* s = leaf->slots();
+        return node_upper_bound(leaf->count, key, [s](size_type i) -> const Key& { return s[i].first; });
+    }
+
+    // 分隔键约定：children[i] 中的键 < keys[i] <= children[i+1] 中的键，因此走向“键数 <= key”的那个孩子
+    LeafNode* descend(const Key& key, Path* path) const {
+        NodeBase* node = root_;
+        if(path) path->depth = 0;
+        while(!node->is_leaf){
+            InternalNode* inner = static_cast<InternalNode*>(node);
+            Key* keys = inner->keys();
+            size_type i = node_upper_bound(inner->count, key, [keys](size_type j) -> const Key& { return keys[j]; });
+            if(path){
+                path->nodes[path->depth] = inner;
+                path->index[path->depth] = i;
+                ++path->depth;
+            }
+            node = inner->children[i];
+        }
+        return static_cast<LeafNode*>(node);
+    }
+
+    // 叶子末尾不是合法位置（最后一个叶子除外，它的末尾就是 end()），转到下一个叶子的开头
+    iterator normalize(LeafNode* leaf, size_type pos) noexcept {
+        if(pos == leaf->count && leaf->next) return iterator(leaf->next, 0);
+        return iterator(leaf, pos);
+    }
+
+    static const Key& min_key(NodeBase* node) noexcept {
+        while(!node->is_leaf) node = static_cast<InternalNode*>(node)->children[0];
+        return static_cast<LeafNode*>(node)->slots()[0].first;
+    }
+
+    /*    ********************** 节点分配 **********************     */
+    LeafNode* new_leaf() {
+        LeafNode* leaf = leaf_alloc_.allocate(1);
+        leaf_alloc_.construct(leaf);
+        return leaf;
+    }
+    InternalNode* new_internal() {
+        InternalNode* node = internal_alloc_.allocate(1);
+        internal_alloc_.construct(node);
+        return node;
+    }
+
+    void free_leaf(LeafNode* leaf) noexcept {
+        leaf_alloc_.destroy(leaf);
+        leaf_alloc_.deallocate(leaf, 1);
+    }
+    void free_internal(InternalNode* node) noexcept {
+        internal_alloc_.destroy(node);
+        internal_alloc_.deallocate(node, 1);
+    }
+
+    void destroy_subtree(NodeBase* node) noexcept {
+        if(node->is_leaf){
+            LeafNode* leaf = static_cast<LeafNode*>(node);
+            for(size_type i = 0; i < leaf->count; ++i) leaf_alloc_.destroy(leaf->slots() + i);
+            free_leaf(leaf);
+        }else{
+            InternalNode* inner = static_cast<InternalNode*>(node);
+            for(size_type i = 0; i <= inner->count; ++i) destroy_subtree(inner->children[i]);
+            for(size_type i = 0; i < inner->count; ++i) key_alloc_.destroy(inner->keys() + i);
+            free_internal(inner);
+        }
+    }
+
+    /*    ********************** 节点内搬移 **********************     */
+    // 槽位是未初始化内存：搬移 = 在目标处移动构造 + 析构源对象
+    // value_type 的键是 const 的，移动构造时键会被拷贝、值会被移动
+    void move_slot(value_type* dst, value_type* src) {
+        leaf_alloc_.construct(dst, std::move(*src));
+        leaf_alloc_.destroy(src);
+    }
+    void move_key(Key* dst, Key* src) {
+        key_alloc_.construct(dst, std::move(*src));
+        key_alloc_.destroy(src);
+    }
+
+    // [pos, count) 整体后移一位，空出 pos
+    void leaf_shift_right(LeafNode* leaf, size_type pos) {
+        value_type* s = leaf->slots();
+        for(size_type i = leaf->count; i > pos; --i) move_slot(s + i, s + i - 1);
+    }
+    // pos 处已析构，(pos, count) 整体前移一位
+    void leaf_shift_left(LeafNode* leaf, size_type pos) {
+        value_type* s = leaf->slots();
+        for(size_type i = pos; i + 1 < leaf->count; ++i) move_slot(s + i, s + i + 1);
+    }
+
+    // 在 keys[idx] 处插入分隔键，其右侧孩子放在 children[idx + 1]
+    template <typename K>
+    void internal_insert(InternalNode* node, size_type idx, K&& key, NodeBase* right) {
+        Key* keys = node->keys();
+        for(size_type i = node->count; i > idx; --i) move_key(keys + i, keys + i - 1);
+        key_alloc_.construct(keys + idx, std::forward<K>(key));
+        for(size_type i = node->count + 1; i > idx + 1; --i) node->children[i] = node->children[i - 1];
+        node->children[idx + 1] = right;
+        ++node->count;
+    }
+    // 删除 keys[idx] 以及它右侧的孩子 children[idx + 1]
+    void internal_erase(InternalNode* node, size_type idx) {
+        Key* keys = node->keys();
+        key_alloc_.destroy(keys + idx);
+        for(size_type i = idx; i + 1 < node->count; ++i) move_key(keys + i, keys + i + 1);
+        for(size_type i = idx + 1; i < node->count; ++i) node->children[i] = node->children[i + 1];
+        --node->count;
+    }
+
+    void link_after(LeafHeader* leaf, LeafHeader* right) noexcept {
+        right->prev = leaf;
+        right->next = leaf->next;
+        if(leaf->next) leaf->next->prev = right;
+        else rightmost_ = right;
+        leaf->next = right;
+    }
+    void unlink(LeafHeader* leaf) noexcept {
+        if(leaf->prev) leaf->prev->next = leaf->next;
+        else leftmost_ = leaf->next;
+        if(leaf->next) leaf->next->prev = leaf->prev;
+        else rightmost_ = leaf->prev;
+    }
+
+    /*    ********************** 插入 **********************     */
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_impl(K&& key, Args&&... args) {
+        if(!root_){
+            LeafNode* leaf = new_leaf();
+            root_ = leaf;
+            leftmost_ = leaf;
+            rightmost_ = leaf;
+        }
+        Path path;
+        LeafNode* leaf = descend(key, &path);
+        size_type pos = leaf_lower_bound(leaf, key);
+        if(pos < leaf->count && !comp_(key, leaf->slots()[pos].first)){
+            return {iterator(leaf, pos), false};
+        }
+
+        if(leaf->count == leaf_capacity){
+            // 向最右叶子末尾追加（顺序插入）时把新元素单独放进新叶子，原叶子保持全满；否则对半分裂
+            bool append = (pos == leaf->count && leaf->next == nullptr);
+            size_type split = append ? leaf->count : leaf->count / 2;
+            LeafNode* right = new_leaf();
+            value_type* src = leaf->slots();
+            value_type* dst = right->slots();
+            for(size_type i = split; i < leaf->count; ++i) move_slot(dst + (i - split), src + i);
+            right->count = static_cast<unsigned short>(leaf->count - split);
+            leaf->count = static_cast<unsigned short>(split);
+            link_after(leaf, right);
+            // 新键比右半部分的最小键还大时放到右边，否则留在左边的末尾
+            if(append){
+                insert_into_parent(path, leaf, Key(key), right);
+                leaf = right;
+                pos = 0;
+            }else{
+                insert_into_parent(path, leaf, Key(right->slots()[0].first), right);
+                if(pos > split){
+                    leaf = right;
+                    pos -= split;
+                }
+            }
+        }
+
+        leaf_shift_right(leaf, pos);
+        try
+        {
+            leaf_alloc_.construct(leaf->slots() + pos, std::piecewise_construct,
+                                  std::forward_as_tuple(std::forward<K>(key)),
+                                  std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+        catch(...)
+        {
+            ++leaf->count;
+            leaf_shift_left(leaf, pos);
+            --leaf->count;
+            throw;
+        }
+        ++leaf->count;
+        ++size_;
+        return {iterator(leaf, pos), true};
+    }
+
+    // node 分裂出了 right，把分隔键插入父节点；父节点溢出时继续向上分裂，根分裂时树长高一层
+    void insert_into_parent(Path& path, NodeBase* node, Key&& sep, NodeBase* right) {
+        for(;;){
+            if(path.depth == 0){
+                InternalNode* root = new_internal();
+                key_alloc_.construct(root->keys(), std::move(sep));
+                root->children[0] = node;
+                root->children[1] = right;
+                root->count = 1;
+                root_ = root;
+                return;
+            }
+            --path.depth;
+            InternalNode* parent = path.nodes[path.depth];
+            internal_insert(parent, path.index[path.depth], std::move(sep), right);
+            if(parent->count <= internal_capacity) return;
+
+            // 溢出：中间的键上推，右半部分的键和孩子移到新节点
+            InternalNode* sibling = new_internal();
+            size_type mid = parent->count / 2;
+            Key* keys = parent->keys();
+            for(size_type i = mid + 1; i < parent->count; ++i){
+                move_key(sibling->keys() + (i - mid - 1), keys + i);
+                sibling->children[i - mid - 1] = parent->children[i];
+            }
+            sibling->children[parent->count - mid - 1] = parent->children[parent->count];
+            sibling->count = static_cast<unsigned short>(parent->count - mid - 1);
+            sep = std::move(keys[mid]);
+            key_alloc_.destroy(keys + mid);
+            parent->count = static_cast<unsigned short>(mid);
+            node = parent;
+            right = sibling;
+        }
+    }
+
+    /*    ********************** 删除 **********************     */
+    void erase_from_leaf(LeafNode* leaf, size_type pos) {
+        leaf_alloc_.destroy(leaf->slots() + pos);
+        leaf_shift_left(leaf, pos);
+        --leaf->count;
+        --size_;
+    }
+
+    void rebalance_leaf(LeafNode* leaf, Path& path) {
+        if(path.depth == 0){
+            if(leaf->count == 0){
+                free_leaf(leaf);
+                root_ = nullptr;
+                leftmost_ = nullptr;
+                rightmost_ = nullptr;
+            }
+            return;
+        }
+        if(leaf->count >= leaf_min) return;
+
+        InternalNode* parent = path.nodes[path.depth - 1];
+        size_type idx = path.index[path.depth - 1];
+        LeafNode* left = idx > 0 ? static_cast<LeafNode*>(parent->children[idx - 1]) : nullptr;
+        LeafNode* right = idx < parent->count ? static_cast<LeafNode*>(parent->children[idx + 1]) : nullptr;
+
+        if(left && left->count > leaf_min){
+            // 向左兄弟借最大的元素，分隔键更新为本节点新的最小键
+            leaf_shift_right(leaf, 0);
+            move_slot(leaf->slots(), left->slots() + left->count - 1);
+            --left->count;
+            ++leaf->count;
+            parent->keys()[idx - 1] = leaf->slots()[0].first;
+        }else if(right && right->count > leaf_min){
+            // 向右兄弟借最小的元素，分隔键更新为右兄弟新的最小键
+            move_slot(leaf->slots() + leaf->count, right->slots());
+            ++leaf->count;
+            leaf_shift_left(right, 0);
+            --right->count;
+            parent->keys()[idx] = right->slots()[0].first;
+        }else if(left){
+            merge_leaves(left, leaf);
+            internal_erase(parent, idx - 1);
+            --path.depth;
+            rebalance_internal(parent, path);
+        }else{
+            merge_leaves(leaf, right);
+            internal_erase(parent, idx);
+            --path.depth;
+            rebalance_internal(parent, path);
+        }
+    }
+
+    // right 的元素全部追加到 left，释放 right
+    void merge_leaves(LeafNode* left, LeafNode* right) {
+        for(size_type i = 0; i < right->count; ++i){
+            move_slot(left->slots() + left->count + i, right->slots() + i);
+        }
+        left->count = static_cast<unsigned short>(left->count + right->count);
+        unlink(right);
+        free_leaf(right);
+    }
+
+    // path.depth 指向 node 自己所在的层
+    void rebalance_internal(InternalNode* node, Path& path) {
+        for(;;){
+            if(path.depth == 0){
+                // 根只剩一个孩子时树变矮一层
+                if(node->count == 0){
+                    root_ = node->children[0];
+                    free_internal(node);
+                }
+                return;
+            }
+            if(node->count >= internal_min) return;
+
+            InternalNode* parent = path.nodes[path.depth - 1];
+            size_type idx = path.index[path.depth - 1];
+            InternalNode* left = idx > 0 ? static_cast<InternalNode*>(parent->children[idx - 1]) : nullptr;
+            InternalNode* right = idx < parent->count ? static_cast<InternalNode*>(parent->children[idx + 1]) : nullptr;
+            Key* pkeys = parent->keys();
+
+            if(left && left->count > internal_min){
+                // 父节点的分隔键下移到本节点最前，左兄弟的最大键上移替换它
+                Key* keys = node->keys();
+                for(size_type i = node->count; i > 0; --i) move_key(keys + i, keys + i - 1);
+                for(size_type i = node->count + 1; i > 0; --i) node->children[i] = node->children[i - 1];
+                key_alloc_.construct(keys, std::move(pkeys[idx - 1]));
+                node->children[0] = left->children[left->count];
+                ++node->count;
+                pkeys[idx - 1] = std::move(left->keys()[left->count - 1]);
+                key_alloc_.destroy(left->keys() + left->count - 1);
+                --left->count;
+                return;
+            }
+            if(right && right->count > internal_min){
+                key_alloc_.construct(node->keys() + node->count, std::move(pkeys[idx]));
+                node->children[node->count + 1] = right->children[0];
+                ++node->count;
+                pkeys[idx] = std::move(right->keys()[0]);
+                key_alloc_.destroy(right->keys());
+                Key* rkeys = right->keys();
+                for(size_type i = 0; i + 1 < right->count; ++i) move_key(rkeys + i, rkeys + i + 1);
+                for(size_type i = 0; i < right->count; ++i) right->children[i] = right->children[i + 1];
+                --right->count;
+                return;
+            }
+            if(left){
+                merge_internal(left, node, pkeys[idx - 1]);
+                internal_erase(parent, idx - 1);
+            }else{
+                merge_internal(node, right, pkeys[idx]);
+                internal_erase(parent, idx);
+            }
+            node = parent;
+            --path.depth;
+        }
+    }
+
+    // left + 分隔键 + right 合并到 left，释放 right
+    void merge_internal(InternalNode* left, InternalNode* right, Key& sep) {
+        Key* lkeys = left->keys();
+        key_alloc_.construct(lkeys + left->count, std::move(sep));
+        for(size_type i = 0; i < right->count; ++i){
+            move_key(lkeys + left->count + 1 + i, right->keys() + i);
+        }
+        for(size_type i = 0; i <= right->count; ++i){
+            left->children[left->count + 1 + i] = right->children[i];
+        }
+        left->count = static_cast<unsigned short>(left->count + 1 + right->count);
+        free_internal(right);
+    }
+
+    /*    ********************** 批量构建 **********************     */
+    // 元素平均分配到 ceil(n / 容量) 个节点中：除了只有一个节点的情况，每个节点都不少于半满
+    template <typename ForwardIt>
+    void build_sorted(ForwardIt first, ForwardIt last, size_type n) {
+        (void)last;
+        if(n == 0) return;
+        size_type leaves = (n + leaf_capacity - 1) / leaf_capacity;
+        simple_stl::vector<NodeBase*> level;
+        level.reserve(leaves);
+        try
+        {
+            LeafHeader* prev = nullptr;
+            for(size_type i = 0; i < leaves; ++i){
+                size_type cnt = n / leaves + (i < n % leaves ? 1 : 0);
+                LeafNode* leaf = new_leaf();
+                leaf->prev = prev;
+                if(prev) prev->next = leaf;
+                else leftmost_ = leaf;
+                prev = leaf;
+                rightmost_ = leaf;
+                level.push_back(leaf);
+                for(; leaf->count < cnt; ++first){
+                    leaf_alloc_.construct(leaf->slots() + leaf->count, *first);
+                    ++leaf->count;
+                    ++size_;
+                }
+            }
+            while(level.size() > 1){
+                size_type m = level.size();
+                size_type nodes = (m + internal_capacity) / (internal_capacity + 1);
+                simple_stl::vector<NodeBase*> upper;
+                upper.reserve(nodes);
+                size_type child = 0;
+                try
+                {
+                    for(size_type i = 0; i < nodes; ++i){
+                        size_type cnt = m / nodes + (i < m % nodes ? 1 : 0);
+                        InternalNode* inner = new_internal();
+                        upper.push_back(inner);
+                        inner->children[0] = level[child++];
+                        for(size_type j = 1; j < cnt; ++j){
+                            key_alloc_.construct(inner->keys() + inner->count, min_key(level[child]));
+                            inner->children[j] = level[child++];
+                            ++inner->count;
+                        }
+                    }
+                }
+                catch(...)
+                {
+                    // 只释放新层的节点本身，它们的孩子仍由 level 持有
+                    for(NodeBase* node : upper){
+                        InternalNode* inner = static_cast<InternalNode*>(node);
+                        for(size_type i = 0; i < inner->count; ++i) key_alloc_.destroy(inner->keys() + i);
+                        free_internal(inner);
+                    }
+                    throw;
+                }
+                // 上一层的节点都已挂到新节点下，树的所有权交给 upper
+                level.swap(upper);
+            }
+            root_ = level[0];
+        }
+        catch(...)
+        {
+            abandon_partial_build(level);
+            throw;
+        }
+    }
+
+    // 构建中途抛异常：level 中的节点（叶子，或完整子树的根）即目前已分配的全部节点
+    void abandon_partial_build(simple_stl::vector<NodeBase*>& level) noexcept {
+        for(NodeBase* node : level) destroy_subtree(node);
+        root_ = nullptr;
+        leftmost_ = nullptr;
+        rightmost_ = nullptr;
+        size_ = 0;
+    }
+};
+
+template <typename Key, typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+void swap(btree_map<Key, T, Compare, Allocator, NodeBytes>& a, btree_map<Key, T, Compare, Allocator, NodeBytes>& b) noexcept {
+    a.swap(b);
+}
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_BTREE_MAP_H
+
+/**
+ * @note 分隔键可能“过时”：删除叶子中的最小元素后父节点的分隔键不会更新，但仍满足
+ * “左子树 < 分隔键 <= 右子树”的约定，查找结果不受影响，省去了向上修改的开销
+ * @note 内部节点的最少键数取 (容量-1)/2 而不是 容量/2：批量构建时平均分配孩子，最后得到的节点恰好能满足这个下限；
+ * 合并时 左(最少) + 分隔键 + 右(少于最少) <= 容量 仍然成立
+ */
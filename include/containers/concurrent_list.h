@@ -0,0 +1,174 @@
+/**
+ * @brief 无锁并发单链表：多线程同时 push_front / push_back 不需要加锁，其他线程可以同时遍历
+ * push_front：对哨兵的 next 做 CAS（Treiber 栈的做法）
+ * push_back ：Michael-Scott 队列的尾插法，先 CAS 尾节点的 next，再尽力推进 tail_；
+ *             tail_ 落后时任何线程都会顺手帮忙推进，因此不会因为某个线程停顿而卡住其他线程
+ * @note 链表只增不删（并发期间），节点在整个链表生命周期内都不会被释放，遍历线程拿到的指针永远有效，
+ * 因此读路径不需要 hazard pointer / epoch 等回收机制；clear() 和析构要求调用方保证没有其他线程在访问
+ * @note 元素一旦发布即视为只读，迭代器只提供 const 访问；分配器需要是线程安全的（默认的 simple_stl::allocator 是无状态的）
+ */
+#ifndef SIMPLE_STL_CONTAINERS_CONCURRENT_LIST_H
+#define SIMPLE_STL_CONTAINERS_CONCURRENT_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include "common/allocator.h"
+#include "common/iterator.h"
+
+namespace simple_stl {
+
+template <typename T, typename Allocator = simple_stl::allocator<T>>
+class concurrent_list
+{
+private:
+    struct NodeBase {
+        std::atomic<NodeBase*> next{nullptr};
+    };
+
+    struct Node : NodeBase {
+        T data;
+        template <typename... Args>
+        explicit Node(Args&&... args) : data(std::forward<Args>(args)...) {}
+    };
+
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = simple_stl::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() noexcept : current_(nullptr) {}
+
+        reference operator*() const noexcept { return static_cast<const Node*>(current_)->data; }
+        pointer operator->() const noexcept { return &static_cast<const Node*>(current_)->data; }
+
+        // acquire 与插入时的 release 配对，保证读到的节点内容是完整构造好的
+        const_iterator& operator++() noexcept {
+            current_ = current_->next.load(std::memory_order_acquire);
+            return *this;
+        }
+        const_iterator operator++(int) noexcept {
+            const_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept { return current_ == other.current_; }
+        bool operator!=(const const_iterator& other) const noexcept { return current_ != other.current_; }
+
+    private:
+        friend class concurrent_list;
+        explicit const_iterator(const NodeBase* node) noexcept : current_(node) {}
+
+        const NodeBase* current_;
+    };
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using iterator = const_iterator;
+    using NodeAllocator = typename Allocator::template rebind<Node>::other;
+
+    concurrent_list(const Allocator& alloc = Allocator()) : tail_(&head_), size_(0), node_alloc_(alloc) {}
+
+    // 并发容器不支持拷贝/移动：其他线程可能持有指向哨兵的指针
+    concurrent_list(const concurrent_list&) = delete;
+    concurrent_list& operator=(const concurrent_list&) = delete;
+
+    ~concurrent_list() { clear(); }
+
+    void push_front(const T& val) { emplace_front(val); }
+    void push_front(T&& val) { emplace_front(std::move(val)); }
+    void push_back(const T& val) { emplace_back(val); }
+    void push_back(T&& val) { emplace_back(std::move(val)); }
+
+    template <typename... Args>
+    void emplace_front(Args&&... args) {
+        Node* node = createNode(std::forward<Args>(args)...);
+        NodeBase* first = head_.next.load(std::memory_order_acquire);
+        do{
+            node->next.store(first, std::memory_order_relaxed);
+            // release：节点内容先于“节点可见”对其他线程生效
+        }while(!head_.next.compare_exchange_weak(first, node, std::memory_order_release, std::memory_order_acquire));
+        size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        Node* node = createNode(std::forward<Args>(args)...);
+        for(;;){
+            NodeBase* tail = tail_.load(std::memory_order_acquire);
+            NodeBase* next = tail->next.load(std::memory_order_acquire);
+            if(next != nullptr){
+                // tail_ 落后于真正的尾节点（其他线程刚插入还没推进，或者有 push_front 插到了空链表），帮忙推进
+                tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            NodeBase* expected = nullptr;
+            if(tail->next.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed)){
+                // 推进失败说明已经有别的线程帮忙推进过了，无需重试
+                tail_.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+                break;
+            }
+        }
+        size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 并发插入期间只是一个近似值
+    size_type size() const noexcept { return size_.load(std::memory_order_relaxed); }
+    bool empty() const noexcept { return head_.next.load(std::memory_order_acquire) == nullptr; }
+
+    // 遍历可以与插入并发进行：遍历开始后插入到尾部的元素可能被看到，插到头部的不会被看到
+    const_iterator begin() const noexcept { return const_iterator(head_.next.load(std::memory_order_acquire)); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+
+    // 需要外部保证没有并发访问
+    void clear() noexcept {
+        NodeBase* curr = head_.next.load(std::memory_order_acquire);
+        while(curr){
+            NodeBase* next = curr->next.load(std::memory_order_relaxed);
+            Node* node = static_cast<Node*>(curr);
+            node_alloc_.destroy(node);
+            node_alloc_.deallocate(node, 1);
+            curr = next;
+        }
+        head_.next.store(nullptr, std::memory_order_relaxed);
+        tail_.store(&head_, std::memory_order_relaxed);
+        size_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    NodeBase head_;                   // 哨兵
+    std::atomic<NodeBase*> tail_;      // 尾节点提示，可能落后于真正的尾节点
+    std::atomic<size_type> size_;
+    NodeAllocator node_alloc_;
+
+    template <typename... Args>
+    Node* createNode(Args&&... args) {
+        Node* node = node_alloc_.allocate(1);
+        try
+        {
+            node_alloc_.construct(node, std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            node_alloc_.deallocate(node, 1);
+            throw;
+        }
+        return node;
+    }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_CONCURRENT_LIST_H
+
+/**
+ * @note compare_exchange_weak 允许“伪失败”（值相等也可能返回false），放在循环里使用代价比 strong 更低；
+ * 推进 tail_ 只尝试一次，用 strong 避免伪失败导致尾指针多落后一步
+ * @note head_/tail_ 位于同一个对象中，高并发时可能伪共享，插入热点集中在一端时影响不大
+ */
@@ -0,0 +1,488 @@
+/**
+ * @brief 分段双端队列：元素存放在若干个固定大小的块中，另有一个“块指针数组”（map）按顺序记录各个块
+ *   map_:  [ - | blk | blk | blk | - | - ]
+ *               ^start_.node     ^finish_.node
+ * 两端插入只会在头/尾块中构造元素，块满了就新分配一个块挂到 map 上；map 本身不够用时只重新分配指针数组，
+ * 元素从不搬家，因此在两端 push/pop 不会使其他元素的引用和指针失效（迭代器会失效，因为迭代器记录了 map 中的位置）
+ * 块回收：两端弹出使某个块变空时，块不立即归还分配器，而是挂到空闲块链表上供下一次分配使用，
+ *        “一端进一端出”的工作队列在稳定状态下不再调用分配器；shrink_to_fit() 释放空闲块
+ * @note 只支持两端的插入删除（不提供中间位置的 insert/erase），这正是作为工作队列底层存储所需的操作
+ */
+#ifndef SIMPLE_STL_CONTAINERS_DEQUE_H
+#define SIMPLE_STL_CONTAINERS_DEQUE_H
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "common/allocator.h"
+#include "common/iterator.h"
+
+namespace simple_stl {
+
+template <typename T, typename Allocator = simple_stl::allocator<T>, std::size_t BlockBytes = 512>
+class deque
+{
+public:
+    // 每块的元素个数：按 BlockBytes 计算，但至少16个，避免大对象退化成“每个元素一个块”
+    static constexpr std::size_t block_size = BlockBytes / sizeof(T) > 16 ? BlockBytes / sizeof(T) : 16;
+
+private:
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = simple_stl::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        Iterator() noexcept : cur_(nullptr), first_(nullptr), last_(nullptr), node_(nullptr) {}
+        // 普通迭代器可以隐式转换为常量迭代器
+        template <bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false>& other) noexcept
+            : cur_(other.cur_), first_(other.first_), last_(other.last_), node_(other.node_) {}
+
+        reference operator*() const noexcept { return *cur_; }
+        pointer operator->() const noexcept { return cur_; }
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        Iterator& operator++() noexcept {
+            if(++cur_ == last_){
+                set_node(node_ + 1);
+                cur_ = first_;
+            }
+            return *this;
+        }
+        Iterator operator++(int) noexcept {
+            Iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+        Iterator& operator--() noexcept {
+            if(cur_ == first_){
+                set_node(node_ - 1);
+                cur_ = last_;
+            }
+            --cur_;
+            return *this;
+        }
+        Iterator operator--(int) noexcept {
+            Iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        // 先算出相对块首的偏移，落在当前块内直接移动指针，否则换算成跨越的块数
+        Iterator& operator+=(difference_type n) noexcept {
+            difference_type offset = n + (cur_ - first_);
+            difference_type bs = static_cast<difference_type>(block_size);
+            if(offset >= 0 && offset < bs){
+                cur_ += n;
+            }else{
+                difference_type node_offset = offset > 0 ? offset / bs : -((-offset - 1) / bs) - 1;
+                set_node(node_ + node_offset);
+                cur_ = first_ + (offset - node_offset * bs);
+            }
+            return *this;
+        }
+        Iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+        friend Iterator operator+(Iterator it, difference_type n) noexcept { return it += n; }
+        friend Iterator operator+(difference_type n, Iterator it) noexcept { return it += n; }
+        friend Iterator operator-(Iterator it, difference_type n) noexcept { return it -= n; }
+
+        friend difference_type operator-(const Iterator& a, const Iterator& b) noexcept {
+            if(a.node_ == b.node_) return a.cur_ - b.cur_;
+            return static_cast<difference_type>(block_size) * (a.node_ - b.node_ - 1)
+                   + (a.cur_ - a.first_) + (b.last_ - b.cur_);
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.cur_ == b.cur_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return a.cur_ != b.cur_; }
+        friend bool operator<(const Iterator& a, const Iterator& b) noexcept {
+            return a.node_ == b.node_ ? a.cur_ < b.cur_ : a.node_ < b.node_;
+        }
+        friend bool operator>(const Iterator& a, const Iterator& b) noexcept { return b < a; }
+        friend bool operator<=(const Iterator& a, const Iterator& b) noexcept { return !(b < a); }
+        friend bool operator>=(const Iterator& a, const Iterator& b) noexcept { return !(a < b); }
+
+    private:
+        friend class deque;
+        template <bool> friend class Iterator;
+
+        void set_node(T** node) noexcept {
+            node_ = node;
+            first_ = *node;
+            last_ = first_ + block_size;
+        }
+
+        T* cur_;   // 当前元素
+        T* first_; // 当前块的首地址
+        T* last_;  // 当前块的尾后地址
+        T** node_; // 当前块在 map 中的位置
+    };
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = simple_stl::reverse_iterator<iterator>;
+    using const_reverse_iterator = simple_stl::reverse_iterator<const_iterator>;
+    using MapAllocator = typename Allocator::template rebind<T*>::other;
+
+    // 默认构造不分配内存，第一次插入时才建立 map 和第一个块
+    deque(const Allocator& alloc = Allocator())
+        : map_(nullptr), map_size_(0), size_(0), spare_(nullptr), spare_count_(0), alloc_(alloc), map_alloc_(alloc) {}
+
+    explicit deque(size_type n, const T& value = T(), const Allocator& alloc = Allocator()) : deque(alloc) {
+        for(size_type i = 0; i < n; ++i) push_back(value);
+    }
+
+    template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    deque(InputIt first, InputIt last, const Allocator& alloc = Allocator()) : deque(alloc) {
+        for(; first != last; ++first) emplace_back(*first);
+    }
+
+    deque(std::initializer_list<T> ilist, const Allocator& alloc = Allocator()) : deque(ilist.begin(), ilist.end(), alloc) {}
+
+    deque(const deque& other) : deque(other.alloc_) {
+        for(const T& value : other) push_back(value);
+    }
+
+    deque(deque&& other) noexcept
+        : map_(other.map_), map_size_(other.map_size_), start_(other.start_), finish_(other.finish_), size_(other.size_),
+          spare_(other.spare_), spare_count_(other.spare_count_), alloc_(std::move(other.alloc_)), map_alloc_(std::move(other.map_alloc_)) {
+        other.reset_empty();
+    }
+
+    // 拷贝并交换：异常安全，且自赋值无需特判
+    deque& operator=(const deque& other) {
+        if(this != &other){
+            deque temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    deque& operator=(deque&& other) noexcept {
+        if(this != &other){
+            release();
+            map_ = other.map_;
+            map_size_ = other.map_size_;
+            start_ = other.start_;
+            finish_ = other.finish_;
+            size_ = other.size_;
+            spare_ = other.spare_;
+            spare_count_ = other.spare_count_;
+            alloc_ = std::move(other.alloc_);
+            map_alloc_ = std::move(other.map_alloc_);
+            other.reset_empty();
+        }
+        return *this;
+    }
+
+    ~deque() { release(); }
+
+    /*    ********************** 迭代器 **********************     */
+    iterator begin() noexcept { return start_; }
+    iterator end() noexcept { return finish_; }
+    const_iterator begin() const noexcept { return start_; }
+    const_iterator end() const noexcept { return finish_; }
+    const_iterator cbegin() const noexcept { return start_; }
+    const_iterator cend() const noexcept { return finish_; }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /*    ********************** 容量与访问 **********************     */
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type max_size() const noexcept { return alloc_.max_size(); }
+    // 空闲链表中缓存的块数
+    size_type spare_blocks() const noexcept { return spare_count_; }
+
+    reference operator[](size_type n) noexcept { return start_[static_cast<difference_type>(n)]; }
+    const_reference operator[](size_type n) const noexcept { return start_[static_cast<difference_type>(n)]; }
+
+    reference at(size_type n) {
+        if(n >= size_){
+            throw std::out_of_range("deque::at: index out of range");
+        }
+        return (*this)[n];
+    }
+    const_reference at(size_type n) const { return const_cast<deque*>(this)->at(n); }
+
+    reference front() noexcept { return *start_; }
+    const_reference front() const noexcept { return *start_; }
+    reference back() noexcept { iterator it = finish_; --it; return *it; }
+    const_reference back() const noexcept { const_iterator it = finish_; --it; return *it; }
+
+    /*    ********************** 两端插入删除 **********************     */
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    // finish_ 总是指向一个已分配块中的空位；尾块写满时先准备好下一个块再构造，保证构造失败时状态不变
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if(!map_) initialize_map();
+        if(finish_.cur_ + 1 != finish_.last_){
+            alloc_.construct(finish_.cur_, std::forward<Args>(args)...);
+            ++finish_.cur_;
+        }else{
+            reserve_map_at_back();
+            *(finish_.node_ + 1) = allocate_block();
+            try
+            {
+                alloc_.construct(finish_.cur_, std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                recycle_block(*(finish_.node_ + 1));
+                throw;
+            }
+            finish_.set_node(finish_.node_ + 1);
+            finish_.cur_ = finish_.first_;
+        }
+        ++size_;
+        return back();
+    }
+
+    template <typename... Args>
+    reference emplace_front(Args&&... args) {
+        if(!map_) initialize_map();
+        if(start_.cur_ != start_.first_){
+            alloc_.construct(start_.cur_ - 1, std::forward<Args>(args)...);
+            --start_.cur_;
+        }else{
+            reserve_map_at_front();
+            *(start_.node_ - 1) = allocate_block();
+            try
+            {
+                alloc_.construct(*(start_.node_ - 1) + (block_size - 1), std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                recycle_block(*(start_.node_ - 1));
+                throw;
+            }
+            start_.set_node(start_.node_ - 1);
+            start_.cur_ = start_.last_ - 1;
+        }
+        ++size_;
+        return front();
+    }
+
+    void pop_back() {
+        if(size_ == 0){
+            throw std::out_of_range("deque::pop_back: container is empty!");
+        }
+        if(finish_.cur_ != finish_.first_){
+            --finish_.cur_;
+        }else{
+            // 尾块已空：回收它，尾部退回到上一个块的最后一个元素
+            recycle_block(finish_.first_);
+            finish_.set_node(finish_.node_ - 1);
+            finish_.cur_ = finish_.last_ - 1;
+        }
+        alloc_.destroy(finish_.cur_);
+        --size_;
+    }
+
+    void pop_front() {
+        if(size_ == 0){
+            throw std::out_of_range("deque::pop_front: container is empty!");
+        }
+        alloc_.destroy(start_.cur_);
+        if(start_.cur_ + 1 != start_.last_){
+            ++start_.cur_;
+        }else{
+            recycle_block(start_.first_);
+            start_.set_node(start_.node_ + 1);
+            start_.cur_ = start_.first_;
+        }
+        --size_;
+    }
+
+    void resize(size_type n) {
+        while(size_ > n) pop_back();
+        while(size_ < n) emplace_back();
+    }
+    void resize(size_type n, const T& value) {
+        while(size_ > n) pop_back();
+        while(size_ < n) push_back(value);
+    }
+
+    // 析构全部元素，只保留头块（其余块进入空闲链表），并把它放回 map 中间，两端都留出扩展空间
+    void clear() noexcept {
+        if(!map_) return;
+        for(iterator it = start_; it != finish_; ++it) alloc_.destroy(it.cur_);
+        for(T** node = start_.node_ + 1; node <= finish_.node_; ++node) recycle_block(*node);
+        T* block = *start_.node_;
+        T** mid = map_ + map_size_ / 2;
+        *mid = block;
+        start_.set_node(mid);
+        start_.cur_ = start_.first_ + block_size / 2;
+        finish_ = start_;
+        size_ = 0;
+    }
+
+    // 释放空闲链表中缓存的块
+    void shrink_to_fit() noexcept {
+        while(spare_){
+            T* block = spare_;
+            std::memcpy(&spare_, block, sizeof(T*));
+            alloc_.deallocate(block, block_size);
+        }
+        spare_count_ = 0;
+    }
+
+    void swap(deque& other) noexcept {
+        std::swap(map_, other.map_);
+        std::swap(map_size_, other.map_size_);
+        std::swap(start_, other.start_);
+        std::swap(finish_, other.finish_);
+        std::swap(size_, other.size_);
+        std::swap(spare_, other.spare_);
+        std::swap(spare_count_, other.spare_count_);
+        std::swap(alloc_, other.alloc_);
+        std::swap(map_alloc_, other.map_alloc_);
+    }
+
+    friend bool operator==(const deque& a, const deque& b) {
+        if(a.size() != b.size()) return false;
+        for(const_iterator i = a.begin(), j = b.begin(); i != a.end(); ++i, ++j){
+            if(!(*i == *j)) return false;
+        }
+        return true;
+    }
+    friend bool operator!=(const deque& a, const deque& b) { return !(a == b); }
+
+private:
+    static const size_type initial_map_size = 8;
+
+    T** map_;              // 块指针数组
+    size_type map_size_;
+    iterator start_;       // 第一个元素
+    iterator finish_;      // 尾后位置，总是落在一个已分配的块内
+    size_type size_;
+    T* spare_;             // 空闲块链表：块的前几个字节存放下一个空闲块的地址
+    size_type spare_count_;
+    Allocator alloc_;
+    MapAllocator map_alloc_;
+
+    void reset_empty() noexcept {
+        map_ = nullptr;
+        map_size_ = 0;
+        start_ = iterator();
+        finish_ = iterator();
+        size_ = 0;
+        spare_ = nullptr;
+        spare_count_ = 0;
+    }
+
+    T* allocate_block() {
+        if(spare_){
+            T* block = spare_;
+            std::memcpy(&spare_, block, sizeof(T*));
+            --spare_count_;
+            return block;
+        }
+        return alloc_.allocate(block_size);
+    }
+
+    // 块中已经没有存活的元素，可以把它的内存当作链表节点使用
+    void recycle_block(T* block) noexcept {
+        std::memcpy(static_cast<void*>(block), &spare_, sizeof(T*));
+        spare_ = block;
+        ++spare_count_;
+    }
+
+    // 首个块放在 map 的中间，两端都能直接扩展；起始位置取块的中间，先 push_front 也不会立即换块
+    void initialize_map() {
+        T** map = map_alloc_.allocate(initial_map_size);
+        try
+        {
+            T** mid = map + initial_map_size / 2;
+            *mid = allocate_block();
+            map_ = map;
+            map_size_ = initial_map_size;
+            start_.set_node(mid);
+            start_.cur_ = start_.first_ + block_size / 2;
+            finish_ = start_;
+        }
+        catch(...)
+        {
+            map_alloc_.deallocate(map, initial_map_size);
+            throw;
+        }
+    }
+
+    void reserve_map_at_back() {
+        if(finish_.node_ + 1 == map_ + map_size_) reallocate_map(false);
+    }
+    void reserve_map_at_front() {
+        if(start_.node_ == map_) reallocate_map(true);
+    }
+
+    // map 的一端用完：已用部分不到一半时在原数组内居中，否则换一个两倍大的数组；只搬移块指针，不动元素
+    void reallocate_map(bool add_at_front) {
+        size_type old_nodes = finish_.node_ - start_.node_ + 1;
+        size_type new_nodes = old_nodes + 1;
+        T** new_start;
+        if(map_size_ > 2 * new_nodes){
+            new_start = map_ + (map_size_ - new_nodes) / 2 + (add_at_front ? 1 : 0);
+            std::memmove(new_start, start_.node_, old_nodes * sizeof(T*));
+        }else{
+            size_type new_map_size = map_size_ * 2 + 2;
+            T** new_map = map_alloc_.allocate(new_map_size);
+            new_start = new_map + (new_map_size - new_nodes) / 2 + (add_at_front ? 1 : 0);
+            std::memcpy(new_start, start_.node_, old_nodes * sizeof(T*));
+            map_alloc_.deallocate(map_, map_size_);
+            map_ = new_map;
+            map_size_ = new_map_size;
+        }
+        T* start_cur = start_.cur_;
+        T* finish_cur = finish_.cur_;
+        start_.set_node(new_start);
+        start_.cur_ = start_cur;
+        finish_.set_node(new_start + old_nodes - 1);
+        finish_.cur_ = finish_cur;
+    }
+
+    void release() noexcept {
+        if(!map_) return;
+        for(iterator it = start_; it != finish_; ++it) alloc_.destroy(it.cur_);
+        for(T** node = start_.node_; node <= finish_.node_; ++node) alloc_.deallocate(*node, block_size);
+        shrink_to_fit();
+        map_alloc_.deallocate(map_, map_size_);
+        reset_empty();
+    }
+};
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void swap(deque<T, Allocator, BlockBytes>& a, deque<T, Allocator, BlockBytes>& b) noexcept {
+    a.swap(b);
+}
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_DEQUE_H
+
+/**
+ * @note 迭代器由 (cur, first, last, node) 四个指针组成：块内移动只改 cur，跨块时通过 node 找到相邻的块，
+ * 因此随机访问 it + n 是 O(1)：先算出跨越的块数，再在目标块内定位
+ * @note 与 vector 的对比：vector 扩容时整体搬迁元素，已有的引用全部失效；deque 扩容只重新分配 map（指针数组）
+ */
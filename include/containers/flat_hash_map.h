@@ -0,0 +1,699 @@
+/**
+ * @brief 开放寻址哈希表（Swiss table 风格）：元素直接存放在连续的槽数组中，另有一个每槽 1 字节的控制字节数组
+ * 控制字节：最高位为1表示空/已删除/哨兵，最高位为0时低7位保存哈希值的低7位（H2）
+ * 查找：用哈希值的高位（H1）定位起始组，一次加载16个控制字节，用 SSE2 同时比较 H2，
+ *       只有 H2 命中的槽才去比较键，绝大多数查找只访问一个控制字节组 + 一个槽
+ * 删除：所在位置前后都存在空槽（探测链不会经过它）时直接置空，否则置为墓碑（kDeleted）
+ * @note 插入、rehash 会使所有迭代器和元素引用失效（元素存放在槽数组中，扩容时整体搬迁）
+ * @note Hash 和 KeyEqual 都定义了 is_transparent 时，find/count/contains/erase 支持异构查找（如用 string_view 查 string 键）
+ */
+#ifndef SIMPLE_STL_CONTAINERS_FLAT_HASH_MAP_H
+#define SIMPLE_STL_CONTAINERS_FLAT_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "common/allocator.h"
+#include "common/iterator.h"
+
+namespace simple_stl {
+
+namespace hash_detail {
+
+using ctrl_t = signed char;
+
+// 控制字节取值：满槽为 [0, 127]，其余均为负数，因此“是否为满槽”只需判断符号位
+const ctrl_t kEmpty = -128;   // 0b10000000
+const ctrl_t kDeleted = -2;   // 0b11111110
+const ctrl_t kSentinel = -1;  // 0b11111111，位于 ctrl[capacity]，迭代到此即结束
+
+inline bool is_full(ctrl_t c) noexcept { return c >= 0; }
+inline bool is_empty_or_deleted(ctrl_t c) noexcept { return c < kSentinel; }
+
+// 组内命中位图，第 i 位为1表示组内第 i 个控制字节满足条件
+class BitMask
+{
+public:
+    explicit BitMask(std::uint32_t mask) noexcept : mask_(mask) {}
+
+    explicit operator bool() const noexcept { return mask_ != 0; }
+    unsigned lowest() const noexcept { return static_cast<unsigned>(__builtin_ctz(mask_)); }
+    void clear_lowest() noexcept { mask_ &= mask_ - 1; }
+
+    // 低位连续0的个数 / 16位内高位连续0的个数，mask为0时返回组宽
+    unsigned trailing_zeros() const noexcept { return mask_ ? static_cast<unsigned>(__builtin_ctz(mask_)) : 16; }
+    unsigned leading_zeros() const noexcept { return mask_ ? static_cast<unsigned>(__builtin_clz(mask_)) - 16 : 16; }
+
+private:
+    std::uint32_t mask_;
+};
+
+#if defined(__SSE2__)
+// 一个组 = 16个控制字节，一条 SSE2 比较指令即可得到整组的匹配结果
+struct Group {
+    static const std::size_t width = 16;
+
+    explicit Group(const ctrl_t* pos) noexcept : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+    BitMask match(ctrl_t h2) const noexcept {
+        return BitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl))));
+    }
+    BitMask match_empty() const noexcept { return match(kEmpty); }
+    // 有符号比较：ctrl < kSentinel 即空或墓碑
+    BitMask match_empty_or_deleted() const noexcept {
+        return BitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl))));
+    }
+    // 从组首开始连续的空/墓碑个数，迭代器借此一次跳过多个空槽
+    unsigned count_leading_empty_or_deleted() const noexcept {
+        std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl)));
+        return static_cast<unsigned>(__builtin_ctz(~mask)); // movemask 只有低16位，~mask 的高位必为1
+    }
+
+private:
+    __m128i ctrl;
+};
+#else
+// 无 SSE2 时逐字节比较，语义与上面一致
+struct Group {
+    static const std::size_t width = 16;
+
+    explicit Group(const ctrl_t* pos) noexcept { std::memcpy(ctrl, pos, width); }
+
+    BitMask match(ctrl_t h2) const noexcept {
+        std::uint32_t mask = 0;
+        for(std::size_t i = 0; i < width; ++i){
+            if(ctrl[i] == h2) mask |= 1u << i;
+        }
+        return BitMask(mask);
+    }
+    BitMask match_empty() const noexcept { return match(kEmpty); }
+    BitMask match_empty_or_deleted() const noexcept {
+        std::uint32_t mask = 0;
+        for(std::size_t i = 0; i < width; ++i){
+            if(is_empty_or_deleted(ctrl[i])) mask |= 1u << i;
+        }
+        return BitMask(mask);
+    }
+    unsigned count_leading_empty_or_deleted() const noexcept {
+        unsigned n = 0;
+        while(n < width && is_empty_or_deleted(ctrl[n])) ++n;
+        return n;
+    }
+
+private:
+    ctrl_t ctrl[width];
+};
+#endif
+
+// 空表共享的控制字节：哨兵 + 一组空槽，使空表的 find/begin 无需特殊判断，且不需要分配内存
+inline ctrl_t* empty_group() noexcept {
+    alignas(16) static ctrl_t group[Group::width] = {
+        kSentinel, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty,
+        kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty};
+    return group;
+}
+
+// std::hash 对整数是恒等映射，直接取高低位会让连续键挤在一起，先做一次混合（murmur3 fmix64）
+inline std::size_t mix(std::size_t h) noexcept {
+    std::uint64_t x = h;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return static_cast<std::size_t>(x);
+}
+
+inline std::size_t h1(std::size_t hash) noexcept { return hash >> 7; }
+inline ctrl_t h2(std::size_t hash) noexcept { return static_cast<ctrl_t>(hash & 0x7F); }
+
+// 容量总是 2^k - 1，最大负载因子 7/8
+inline std::size_t capacity_to_growth(std::size_t capacity) noexcept { return capacity - capacity / 8; }
+inline std::size_t normalize_capacity(std::size_t n) noexcept {
+    std::size_t cap = Group::width - 1;
+    while(cap < n) cap = cap * 2 + 1;
+    return cap;
+}
+
+// 三角探测：依次跳过 0, 16, 32, 48... 个位置，容量为 2^k - 1 时可以遍历所有组
+class ProbeSeq
+{
+public:
+    ProbeSeq(std::size_t hash, std::size_t mask) noexcept : mask_(mask), offset_(hash & mask), index_(0) {}
+
+    std::size_t offset() const noexcept { return offset_; }
+    std::size_t offset(std::size_t i) const noexcept { return (offset_ + i) & mask_; }
+    std::size_t index() const noexcept { return index_; }
+
+    void next() noexcept {
+        index_ += Group::width;
+        offset_ = (offset_ + index_) & mask_;
+    }
+
+private:
+    std::size_t mask_;
+    std::size_t offset_;
+    std::size_t index_;
+};
+
+template <typename Hash, typename KeyEqual, typename = void>
+struct is_transparent : std::false_type {};
+template <typename Hash, typename KeyEqual>
+struct is_transparent<Hash, KeyEqual,
+    std::void_t<typename Hash::is_transparent, typename KeyEqual::is_transparent>> : std::true_type {};
+
+} // namespace hash_detail
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = simple_stl::allocator<std::pair<const Key, Value>>>
+class flat_hash_map
+{
+    using ctrl_t = hash_detail::ctrl_t;
+    using Group = hash_detail::Group;
+
+    // 只有 Hash 和 KeyEqual 都声明透明时才开放异构查找，否则模板重载不参与决议
+    template <typename K>
+    using enable_if_transparent_t = typename std::enable_if<hash_detail::is_transparent<Hash, KeyEqual>::value, K>::type;
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = simple_stl::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<const Key, Value>;
+        using pointer = typename std::conditional<Const, const value_type*, value_type*>::type;
+        using reference = typename std::conditional<Const, const value_type&, value_type&>::type;
+
+        Iterator() noexcept : ctrl_(nullptr), slot_(nullptr) {}
+        // 普通迭代器可以隐式转换为常量迭代器
+        template <bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false>& other) noexcept : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+        reference operator*() const noexcept { return *slot_; }
+        pointer operator->() const noexcept { return slot_; }
+
+        Iterator& operator++() noexcept {
+            ++ctrl_;
+            ++slot_;
+            skip_empty_or_deleted();
+            return *this;
+        }
+        Iterator operator++(int) noexcept {
+            Iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.ctrl_ == b.ctrl_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return a.ctrl_ != b.ctrl_; }
+
+    private:
+        friend class flat_hash_map;
+        template <bool> friend class Iterator;
+
+        Iterator(ctrl_t* ctrl, value_type* slot) noexcept : ctrl_(ctrl), slot_(slot) {}
+
+        // 按组跳过空槽和墓碑，哨兵不是空槽，因此一定会停在末尾
+        void skip_empty_or_deleted() noexcept {
+            while(hash_detail::is_empty_or_deleted(*ctrl_)){
+                unsigned shift = Group(ctrl_).count_leading_empty_or_deleted();
+                ctrl_ += shift;
+                slot_ += shift;
+            }
+        }
+
+        ctrl_t* ctrl_;
+        value_type* slot_;
+    };
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using SlotAllocator = typename Allocator::template rebind<value_type>::other;
+    using CtrlAllocator = typename Allocator::template rebind<ctrl_t>::other;
+
+    flat_hash_map() : flat_hash_map(0) {}
+
+    explicit flat_hash_map(size_type bucket_count, const Hash& hash = Hash(), const KeyEqual& eq = KeyEqual(),
+                           const Allocator& alloc = Allocator())
+        : ctrl_(hash_detail::empty_group()), slots_(nullptr), size_(0), capacity_(0), growth_left_(0),
+          hash_(hash), eq_(eq), slot_alloc_(alloc), ctrl_alloc_(alloc) {
+        if(bucket_count > 0){
+            initialize(hash_detail::normalize_capacity(bucket_count));
+        }
+    }
+
+    template <typename InputIt>
+    flat_hash_map(InputIt first, InputIt last, size_type bucket_count = 0, const Hash& hash = Hash(),
+                  const KeyEqual& eq = KeyEqual(), const Allocator& alloc = Allocator())
+        : flat_hash_map(bucket_count, hash, eq, alloc) {
+        insert(first, last);
+    }
+
+    flat_hash_map(std::initializer_list<value_type> ilist, size_type bucket_count = 0, const Hash& hash = Hash(),
+                  const KeyEqual& eq = KeyEqual(), const Allocator& alloc = Allocator())
+        : flat_hash_map(bucket_count, hash, eq, alloc) {
+        reserve(ilist.size());
+        insert(ilist.begin(), ilist.end());
+    }
+
+    flat_hash_map(const flat_hash_map& other)
+        : flat_hash_map(0, other.hash_, other.eq_, other.slot_alloc_) {
+        reserve(other.size_);
+        // 目标表刚创建且容量足够，直接按哈希落位，不需要比较键
+        for(const_iterator it = other.begin(); it != other.end(); ++it){
+            size_type hash = hash_of(it->first);
+            size_type index = find_first_non_full(hash);
+            construct_at(index, hash, *it);
+        }
+    }
+
+    flat_hash_map(flat_hash_map&& other) noexcept
+        : ctrl_(other.ctrl_), slots_(other.slots_), size_(other.size_), capacity_(other.capacity_),
+          growth_left_(other.growth_left_), hash_(std::move(other.hash_)), eq_(std::move(other.eq_)),
+          slot_alloc_(std::move(other.slot_alloc_)), ctrl_alloc_(std::move(other.ctrl_alloc_)) {
+        other.reset_empty();
+    }
+
+    // 拷贝并交换：异常安全，且自赋值无需特判
+    flat_hash_map& operator=(const flat_hash_map& other) {
+        if(this != &other){
+            flat_hash_map temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    flat_hash_map& operator=(flat_hash_map&& other) noexcept {
+        if(this != &other){
+            destroy_and_deallocate();
+            ctrl_ = other.ctrl_;
+            slots_ = other.slots_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            growth_left_ = other.growth_left_;
+            hash_ = std::move(other.hash_);
+            eq_ = std::move(other.eq_);
+            slot_alloc_ = std::move(other.slot_alloc_);
+            ctrl_alloc_ = std::move(other.ctrl_alloc_);
+            other.reset_empty();
+        }
+        return *this;
+    }
+
+    flat_hash_map& operator=(std::initializer_list<value_type> ilist) {
+        clear();
+        insert(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    ~flat_hash_map() { destroy_and_deallocate(); }
+
+    /*    ********************** 迭代器 **********************     */
+    iterator begin() noexcept {
+        iterator it(ctrl_, slots_);
+        it.skip_empty_or_deleted();
+        return it;
+    }
+    iterator end() noexcept { return iterator(ctrl_ + capacity_, nullptr); }
+    const_iterator begin() const noexcept { return const_cast<flat_hash_map*>(this)->begin(); }
+    const_iterator end() const noexcept { return const_cast<flat_hash_map*>(this)->end(); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /*    ********************** 容量 **********************     */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+    size_type bucket_count() const noexcept { return capacity_; }
+    float load_factor() const noexcept { return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f; }
+    float max_load_factor() const noexcept { return 7.0f / 8.0f; }
+
+    // 保证插入 n 个元素期间不会 rehash
+    void reserve(size_type n) {
+        if(n > size_ + growth_left_){
+            size_type cap = hash_detail::normalize_capacity(n + (n - 1) / 7);
+            resize(cap);
+        }
+    }
+
+    // 按至少 n 个槽重建；n 为0时收缩到能容纳当前元素的最小容量，同时清除所有墓碑
+    void rehash(size_type n) {
+        if(n == 0 && size_ == 0){
+            destroy_and_deallocate();
+            reset_empty();
+            return;
+        }
+        size_type need = size_ + (size_ ? (size_ - 1) / 7 : 0);
+        size_type cap = hash_detail::normalize_capacity(n > need ? n : need);
+        if(n == 0 || cap > capacity_) resize(cap);
+    }
+
+    /*    ********************** 修改 **********************     */
+    // 只析构元素、把控制字节全部置空，保留已分配的内存
+    void clear() noexcept {
+        if(capacity_ == 0) return;
+        destroy_slots();
+        reset_ctrl();
+        size_ = 0;
+        growth_left_ = hash_detail::capacity_to_growth(capacity_);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace_impl(value.first, std::move(value.second));
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        for(; first != last; ++first){
+            insert(*first);
+        }
+    }
+    void insert(std::initializer_list<value_type> ilist) { insert(ilist.begin(), ilist.end()); }
+
+    // 键不存在时才构造值；键已存在时 args 不会被移动
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+        return try_emplace_impl(key, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    // 先构造完整的元素再查找：键存在时这次构造会被浪费，已知键时优先使用 try_emplace
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(std::forward<Args>(args)...);
+        return try_emplace_impl(value.first, std::move(value.second));
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+        std::pair<iterator, bool> res = try_emplace_impl(key, std::forward<M>(obj));
+        if(!res.second) res.first->second = std::forward<M>(obj);
+        return res;
+    }
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj) {
+        std::pair<iterator, bool> res = try_emplace_impl(std::move(key), std::forward<M>(obj));
+        if(!res.second) res.first->second = std::forward<M>(obj);
+        return res;
+    }
+
+    // 返回被删除元素的下一个位置（删除不会移动其他元素，迭代器仍然有效）
+    iterator erase(const_iterator pos) noexcept {
+        iterator next(pos.ctrl_, pos.slot_);
+        erase_at(static_cast<size_type>(pos.ctrl_ - ctrl_));
+        ++next;
+        return next;
+    }
+    iterator erase(iterator pos) noexcept { return erase(const_iterator(pos)); }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        while(first != last){
+            first = erase(first);
+        }
+        return iterator(last.ctrl_, last.slot_);
+    }
+
+    size_type erase(const key_type& key) { return erase_key(key); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    size_type erase(const K& key) { return erase_key(key); }
+
+    void swap(flat_hash_map& other) noexcept {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(growth_left_, other.growth_left_);
+        std::swap(hash_, other.hash_);
+        std::swap(eq_, other.eq_);
+    }
+
+    /*    ********************** 查找 **********************     */
+    iterator find(const key_type& key) { return find_impl(key); }
+    const_iterator find(const key_type& key) const { return const_cast<flat_hash_map*>(this)->find_impl(key); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    iterator find(const K& key) { return find_impl(key); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    const_iterator find(const K& key) const { return const_cast<flat_hash_map*>(this)->find_impl(key); }
+
+    bool contains(const key_type& key) const { return find(key) != end(); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    Value& at(const key_type& key) {
+        iterator it = find(key);
+        if(it == end()){
+            throw std::out_of_range("flat_hash_map::at: key not found");
+        }
+        return it->second;
+    }
+    const Value& at(const key_type& key) const { return const_cast<flat_hash_map*>(this)->at(key); }
+
+    Value& operator[](const key_type& key) { return try_emplace_impl(key).first->second; }
+    Value& operator[](key_type&& key) { return try_emplace_impl(std::move(key)).first->second; }
+
+    hasher hash_function() const { return hash_; }
+    key_equal key_eq() const { return eq_; }
+    allocator_type get_allocator() const { return allocator_type(slot_alloc_); }
+
+    friend bool operator==(const flat_hash_map& a, const flat_hash_map& b) {
+        if(a.size() != b.size()) return false;
+        for(const_iterator it = a.begin(); it != a.end(); ++it){
+            const_iterator other = b.find(it->first);
+            if(other == b.end() || !(other->second == it->second)) return false;
+        }
+        return true;
+    }
+    friend bool operator!=(const flat_hash_map& a, const flat_hash_map& b) { return !(a == b); }
+
+private:
+    ctrl_t* ctrl_;            // capacity_ + 1(哨兵) + Group::width - 1(首组的镜像) 个控制字节
+    value_type* slots_;       // capacity_ 个槽
+    size_type size_;
+    size_type capacity_;      // 0 或 2^k - 1
+    size_type growth_left_;   // 还能占用多少个空槽（墓碑复用不消耗）
+    Hash hash_;
+    KeyEqual eq_;
+    SlotAllocator slot_alloc_;
+    CtrlAllocator ctrl_alloc_;
+
+    static size_type ctrl_bytes(size_type capacity) noexcept { return capacity + Group::width; }
+
+    template <typename K>
+    size_type hash_of(const K& key) const { return hash_detail::mix(hash_(key)); }
+
+    // 末尾 width-1 个字节镜像 ctrl[0, width-1)，使从任意位置加载一整组都不会越界且无需回绕
+    void set_ctrl(size_type i, ctrl_t h) noexcept {
+        ctrl_[i] = h;
+        ctrl_[((i - (Group::width - 1)) & capacity_) + (Group::width - 1)] = h;
+    }
+
+    void reset_ctrl() noexcept {
+        std::memset(ctrl_, static_cast<unsigned char>(hash_detail::kEmpty), ctrl_bytes(capacity_));
+        ctrl_[capacity_] = hash_detail::kSentinel;
+    }
+
+    void reset_empty() noexcept {
+        ctrl_ = hash_detail::empty_group();
+        slots_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+        growth_left_ = 0;
+    }
+
+    void initialize(size_type capacity) {
+        ctrl_t* ctrl = ctrl_alloc_.allocate(ctrl_bytes(capacity));
+        value_type* slots;
+        try
+        {
+            slots = slot_alloc_.allocate(capacity);
+        }
+        catch(...)
+        {
+            ctrl_alloc_.deallocate(ctrl, ctrl_bytes(capacity));
+            throw;
+        }
+        ctrl_ = ctrl;
+        slots_ = slots;
+        capacity_ = capacity;
+        reset_ctrl();
+        growth_left_ = hash_detail::capacity_to_growth(capacity_) - size_;
+    }
+
+    void destroy_slots() noexcept {
+        for(size_type i = 0; i != capacity_; ++i){
+            if(hash_detail::is_full(ctrl_[i])) slot_alloc_.destroy(slots_ + i);
+        }
+    }
+
+    void destroy_and_deallocate() noexcept {
+        if(capacity_ == 0) return;
+        destroy_slots();
+        ctrl_alloc_.deallocate(ctrl_, ctrl_bytes(capacity_));
+        slot_alloc_.deallocate(slots_, capacity_);
+    }
+
+    // 搬迁到新的槽数组：新表中没有墓碑也没有重复键，按哈希找到第一个空槽即可
+    // value_type 的键是 const 的，移动构造 pair 时键会被拷贝、值会被移动
+    void resize(size_type new_capacity) {
+        ctrl_t* old_ctrl = ctrl_;
+        value_type* old_slots = slots_;
+        size_type old_capacity = capacity_;
+
+        size_type count = size_;
+        size_ = 0;
+        try
+        {
+            initialize(new_capacity);
+        }
+        catch(...)
+        {
+            size_ = count;
+            throw;
+        }
+        for(size_type i = 0; i != old_capacity; ++i){
+            if(hash_detail::is_full(old_ctrl[i])){
+                size_type hash = hash_of(old_slots[i].first);
+                size_type index = find_first_non_full(hash);
+                construct_at(index, hash, std::move(old_slots[i]));
+                slot_alloc_.destroy(old_slots + i);
+            }
+        }
+        if(old_capacity){
+            ctrl_alloc_.deallocate(old_ctrl, ctrl_bytes(old_capacity));
+            slot_alloc_.deallocate(old_slots, old_capacity);
+        }
+    }
+
+    // 墓碑太多（元素不足容量的 25/32）时原地容量重建即可回收，否则翻倍
+    void rehash_and_grow_if_necessary() {
+        if(capacity_ == 0){
+            resize(Group::width - 1);
+        }else if(size_ * 32 <= capacity_ * 25){
+            resize(capacity_);
+        }else{
+            resize(capacity_ * 2 + 1);
+        }
+    }
+
+    size_type find_first_non_full(size_type hash) const noexcept {
+        hash_detail::ProbeSeq seq(hash_detail::h1(hash), capacity_);
+        for(;;){
+            Group g(ctrl_ + seq.offset());
+            hash_detail::BitMask mask = g.match_empty_or_deleted();
+            if(mask) return seq.offset(mask.lowest());
+            seq.next();
+        }
+    }
+
+    template <typename... Args>
+    void construct_at(size_type index, size_type hash, Args&&... args) {
+        slot_alloc_.construct(slots_ + index, std::forward<Args>(args)...);
+        if(ctrl_[index] == hash_detail::kEmpty) --growth_left_;
+        set_ctrl(index, hash_detail::h2(hash));
+        ++size_;
+    }
+
+    template <typename K>
+    iterator find_impl(const K& key) { return find_with_hash(key, hash_of(key)); }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_impl(K&& key, Args&&... args) {
+        size_type hash = hash_of(key);
+        iterator it = find_with_hash(key, hash);
+        if(it != end()) return {it, false};
+
+        size_type index = find_first_non_full(hash);
+        if(growth_left_ == 0 && ctrl_[index] != hash_detail::kDeleted){
+            rehash_and_grow_if_necessary();
+            index = find_first_non_full(hash);
+        }
+        construct_at(index, hash, std::piecewise_construct,
+                     std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(ctrl_ + index, slots_ + index), true};
+    }
+
+    template <typename K>
+    iterator find_with_hash(const K& key, size_type hash) {
+        hash_detail::ProbeSeq seq(hash_detail::h1(hash), capacity_);
+        ctrl_t tag = hash_detail::h2(hash);
+        for(;;){
+            Group g(ctrl_ + seq.offset());
+            for(hash_detail::BitMask mask = g.match(tag); mask; mask.clear_lowest()){
+                size_type index = seq.offset(mask.lowest());
+                if(eq_(slots_[index].first, key)) return iterator(ctrl_ + index, slots_ + index);
+            }
+            // 组内出现空槽说明探测链到此为止（墓碑不会终止探测）
+            if(g.match_empty()) return end();
+            seq.next();
+        }
+    }
+
+    template <typename K>
+    size_type erase_key(const K& key) {
+        iterator it = find_impl(key);
+        if(it == end()) return 0;
+        erase_at(static_cast<size_type>(it.ctrl_ - ctrl_));
+        return 1;
+    }
+
+    // index 前后两组内空槽的距离之和小于组宽时，任何一次组加载都不可能“跨过”该位置继续探测，可以直接置空
+    void erase_at(size_type index) noexcept {
+        slot_alloc_.destroy(slots_ + index);
+        --size_;
+        size_type index_before = (index - Group::width) & capacity_;
+        hash_detail::BitMask empty_after = Group(ctrl_ + index).match_empty();
+        hash_detail::BitMask empty_before = Group(ctrl_ + index_before).match_empty();
+        bool was_never_full = empty_before && empty_after &&
+                              empty_after.trailing_zeros() + empty_before.leading_zeros() < Group::width;
+        set_ctrl(index, was_never_full ? hash_detail::kEmpty : hash_detail::kDeleted);
+        if(was_never_full) ++growth_left_;
+    }
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Allocator>
+void swap(flat_hash_map<Key, Value, Hash, KeyEqual, Allocator>& a,
+          flat_hash_map<Key, Value, Hash, KeyEqual, Allocator>& b) noexcept {
+    a.swap(b);
+}
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_FLAT_HASH_MAP_H
+
+/**
+ * @note 与 std::unordered_map 的对比：后者每个元素一个堆节点、桶数组里存链表头指针，
+ * 一次查找至少要访问“桶 -> 节点 -> 下一个节点……”；这里元素与控制字节都是连续数组，
+ * 命中时通常只有“控制字节组 + 目标槽”两处访存，未命中时往往只需一次控制字节组的加载
+ * @note H2 只有7位，同一组内误判的概率约为 1/128，比较键的次数几乎总是0或1次
+ * @note 容量取 2^k - 1 而不是 2^k：哨兵正好放在 ctrl[capacity]，取模用 & capacity 即可
+ */
@@ -0,0 +1,435 @@
+/**
+ * @brief 有序扁平映射 flat_map / flat_set：元素按键有序地存放在一个 simple_stl::vector 中
+ * 与 std::map 的对比：没有每元素一个红黑树节点的开销（3个指针 + 颜色 + 堆分配头），
+ * 查找是连续内存上的二分，遍历是线性扫描；代价是单个插入/删除需要搬移 O(n) 个元素
+ * 适用于“读多写少、规模中小”的场景，批量写入请用 insert(first, last) 或 insert(sorted_unique, first, last)，只做一次归并
+ * 查找布局（Layout 模板参数）：
+ *   sorted_layout    ：直接在有序数组上做无分支二分查找（默认）
+ *   eytzinger_layout ：额外维护一份按 Eytzinger（BFS/堆序）排列的键副本，查找路径上的前几层集中在少数缓存行中，
+ *                      并且可以提前预取下一层；每次修改都会重建索引，只适合构建后基本只读的表
+ * @note 任何插入、删除都会使迭代器失效；通过迭代器修改 flat_map 元素的 first 会破坏有序性
+ */
+#ifndef SIMPLE_STL_CONTAINERS_FLAT_MAP_H
+#define SIMPLE_STL_CONTAINERS_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/allocator.h"
+#include "common/utilities.h"
+#include "containers/vector.h"
+
+namespace simple_stl {
+
+struct sorted_layout {};
+struct eytzinger_layout {};
+
+namespace flat_detail {
+
+// 无分支二分：每轮只根据一次比较选择 base 或 base + half，编译器会生成 cmov 而不是条件跳转，
+// 没有分支预测失败；循环次数只取决于 n，与键的分布无关
+template <typename It, typename K, typename Less>
+It branchless_lower_bound(It first, std::size_t n, const K& key, Less less) {
+    if(n == 0) return first;
+    It base = first;
+    while(n > 1){
+        std::size_t half = n / 2;
+        base = less(base[half - 1], key) ? base + half : base;
+        n -= half;
+    }
+    return base + (less(*base, key) ? 1 : 0);
+}
+
+template <typename Compare, typename = void>
+struct is_transparent : std::false_type {};
+template <typename Compare>
+struct is_transparent<Compare, std::void_t<typename Compare::is_transparent>> : std::true_type {};
+
+// 从元素取出键
+struct identity_key {
+    template <typename T>
+    const T& operator()(const T& value) const noexcept { return value; }
+};
+struct first_key {
+    template <typename Pair>
+    const typename Pair::first_type& operator()(const Pair& value) const noexcept { return value.first; }
+};
+
+// 查找索引：sorted_layout 不需要额外数据，直接在元素数组上二分
+template <typename Key, typename Compare, typename Layout>
+class search_index
+{
+public:
+    template <typename Vec, typename KeyOf>
+    void rebuild(const Vec&, KeyOf) noexcept {}
+
+    template <typename Vec, typename KeyOf, typename K>
+    std::size_t lower_bound(const Vec& data, const K& key, const Compare& comp, KeyOf key_of) const {
+        auto less = [&](const typename Vec::value_type& v, const K& k) { return comp(key_of(v), k); };
+        return branchless_lower_bound(data.begin(), data.size(), key, less) - data.begin();
+    }
+};
+
+// Eytzinger 布局：keys_[k] 的左右孩子是 keys_[2k] 和 keys_[2k+1]（下标从1开始），
+// 在这种排列上“二分”就是从根往下走，第 k 层的节点在内存中相邻，前几层只占少数几个缓存行
+template <typename Key, typename Compare>
+class search_index<Key, Compare, eytzinger_layout>
+{
+public:
+    template <typename Vec, typename KeyOf>
+    void rebuild(const Vec& data, KeyOf key_of) {
+        simple_stl::vector<Key> keys;
+        simple_stl::vector<std::size_t> rank;
+        std::size_t n = data.size();
+        if(n != 0){
+            keys.reserve(n + 1);
+            rank.reserve(n + 1);
+            for(std::size_t k = 0; k <= n; ++k) rank.push_back(0);
+            fill_rank(rank, n, 0, 1);
+            keys.push_back(key_of(data[0])); // 下标0不参与查找，占位以便下标从1开始
+            for(std::size_t k = 1; k <= n; ++k) keys.push_back(key_of(data[rank[k]]));
+        }
+        keys_.swap(keys);
+        rank_.swap(rank);
+    }
+
+    template <typename Vec, typename KeyOf, typename K>
+    std::size_t lower_bound(const Vec& data, const K& key, const Compare& comp, KeyOf) const {
+        std::size_t n = data.size();
+        const Key* keys = keys_.data();
+        std::size_t k = 1;
+        while(k <= n){
+            // 16 层之后的后代距离当前节点 16k 个元素，提前一次性预取（地址越界的预取不会触发访存错误）
+            __builtin_prefetch(reinterpret_cast<const char*>(keys) + sizeof(Key) * 16 * k);
+            k = 2 * k + (comp(keys[k], key) ? 1 : 0);
+        }
+        // k 的二进制末尾连续的1代表最后几步“向右走”，去掉它们和再上一个0，得到最后一次向左走的节点
+        k >>= __builtin_ffsll(static_cast<long long>(~k));
+        return k == 0 ? n : rank_[k];
+    }
+
+private:
+    simple_stl::vector<Key> keys_;
+    simple_stl::vector<std::size_t> rank_; // rank_[k]：keys_[k] 在有序数组中的下标
+
+    // 按中序遍历给完全二叉树的节点依次编号，即得到每个节点对应的有序下标
+    static std::size_t fill_rank(simple_stl::vector<std::size_t>& rank, std::size_t n, std::size_t i, std::size_t k) {
+        if(k <= n){
+            i = fill_rank(rank, n, i, 2 * k);
+            rank[k] = i++;
+            i = fill_rank(rank, n, i, 2 * k + 1);
+        }
+        return i;
+    }
+};
+
+// flat_map 与 flat_set 的公共实现（类似 STL 中 map/set 共用红黑树）
+template <typename Key, typename Value, typename KeyOf, typename Compare, typename Layout, typename Allocator>
+class flat_tree
+{
+    using container_type = simple_stl::vector<Value, Allocator>;
+
+    template <typename K>
+    using enable_if_transparent_t = typename std::enable_if<is_transparent<Compare>::value, K>::type;
+
+public:
+    using key_type = Key;
+    using value_type = Value;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value&;
+    using const_reference = const Value&;
+    // set 的元素即键，迭代器只能是只读的；map 的迭代器可以修改 second
+    using const_iterator = typename container_type::const_iterator;
+    using iterator = typename std::conditional<std::is_same<Key, Value>::value,
+                                               const_iterator, typename container_type::iterator>::type;
+    using reverse_iterator = simple_stl::reverse_iterator<iterator>;
+    using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+    flat_tree() = default;
+    explicit flat_tree(const Compare& comp) : comp_(comp) {}
+
+    template <typename InputIt>
+    flat_tree(InputIt first, InputIt last, const Compare& comp = Compare()) : comp_(comp) {
+        insert(first, last);
+    }
+    template <typename InputIt>
+    flat_tree(sorted_unique_t, InputIt first, InputIt last, const Compare& comp = Compare()) : comp_(comp) {
+        insert(sorted_unique, first, last);
+    }
+    flat_tree(std::initializer_list<Value> ilist, const Compare& comp = Compare()) : comp_(comp) {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    iterator begin() noexcept { return data_.begin(); }
+    iterator end() noexcept { return data_.end(); }
+    const_iterator begin() const noexcept { return data_.begin(); }
+    const_iterator end() const noexcept { return data_.end(); }
+    const_iterator cbegin() const noexcept { return data_.cbegin(); }
+    const_iterator cend() const noexcept { return data_.cend(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return data_.rbegin(); }
+    const_reverse_iterator rend() const noexcept { return data_.rend(); }
+
+    bool empty() const noexcept { return data_.empty(); }
+    size_type size() const noexcept { return data_.size(); }
+    size_type capacity() const noexcept { return data_.capacity(); }
+    void reserve(size_type n) { data_.reserve(n); }
+
+    key_compare key_comp() const { return comp_; }
+
+    void clear() noexcept {
+        data_.clear();
+        index_.rebuild(data_, KeyOf());
+    }
+
+    /*    ********************** 查找 **********************     */
+    iterator lower_bound(const Key& key) { return begin() + lower_index(key); }
+    const_iterator lower_bound(const Key& key) const { return begin() + lower_index(key); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    iterator lower_bound(const K& key) { return begin() + lower_index(key); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    const_iterator lower_bound(const K& key) const { return begin() + lower_index(key); }
+
+    iterator upper_bound(const Key& key) { return begin() + upper_index(key); }
+    const_iterator upper_bound(const Key& key) const { return begin() + upper_index(key); }
+
+    iterator find(const Key& key) { return begin() + find_index(key); }
+    const_iterator find(const Key& key) const { return begin() + find_index(key); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    iterator find(const K& key) { return begin() + find_index(key); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    const_iterator find(const K& key) const { return begin() + find_index(key); }
+
+    bool contains(const Key& key) const { return find_index(key) != size(); }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    bool contains(const K& key) const { return find_index(key) != size(); }
+
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+    template <typename K, typename = enable_if_transparent_t<K>>
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    std::pair<iterator, iterator> equal_range(const Key& key) {
+        iterator it = find(key);
+        return {it, it == end() ? it : it + 1};
+    }
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+        const_iterator it = find(key);
+        return {it, it == end() ? it : it + 1};
+    }
+
+    /*    ********************** 插入 **********************     */
+    std::pair<iterator, bool> insert(const Value& value) { return insert_unique(value); }
+    std::pair<iterator, bool> insert(Value&& value) { return insert_unique(std::move(value)); }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert_unique(Value(std::forward<Args>(args)...));
+    }
+
+    // 批量插入：先把新元素排序去重，再与已有数组做一次线性归并，总代价 O(m log m + n + m)，
+    // 而逐个插入是 O(m * n)；键重复时保留已有的元素（与逐个 insert 的语义一致）
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        container_type incoming;
+        for(; first != last; ++first){
+            incoming.emplace_back(*first);
+        }
+        // 稳定排序：同键的多个新元素中保留最先出现的那个
+        std::stable_sort(incoming.begin(), incoming.end(),
+                         [this](const Value& a, const Value& b) { return comp_(KeyOf()(a), KeyOf()(b)); });
+        merge_sorted(incoming.begin(), incoming.end());
+    }
+
+    template <typename InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last) {
+        merge_sorted(first, last);
+    }
+
+    void insert(std::initializer_list<Value> ilist) { insert(ilist.begin(), ilist.end()); }
+
+    /*    ********************** 删除 **********************     */
+    // iterator 是原始指针，可以隐式转换为 const_iterator，因此不需要单独的 erase(iterator) 重载
+    iterator erase(const_iterator pos) {
+        iterator it = data_.erase(pos);
+        index_.rebuild(data_, KeyOf());
+        return it;
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        size_type index = first - begin();
+        data_.erase(first, last);
+        index_.rebuild(data_, KeyOf());
+        return begin() + index;
+    }
+
+    size_type erase(const Key& key) {
+        size_type index = find_index(key);
+        if(index == size()) return 0;
+        erase(begin() + index);
+        return 1;
+    }
+
+    void swap(flat_tree& other) noexcept {
+        data_.swap(other.data_);
+        std::swap(comp_, other.comp_);
+        std::swap(index_, other.index_);
+    }
+
+    friend bool operator==(const flat_tree& a, const flat_tree& b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    }
+    friend bool operator!=(const flat_tree& a, const flat_tree& b) { return !(a == b); }
+
+protected:
+    container_type data_;
+    Compare comp_;
+    search_index<Key, Compare, Layout> index_;
+
+    template <typename K>
+    size_type lower_index(const K& key) const {
+        return index_.lower_bound(data_, key, comp_, KeyOf());
+    }
+
+    size_type upper_index(const Key& key) const {
+        size_type i = lower_index(key);
+        return (i != size() && !comp_(key, KeyOf()(data_[i]))) ? i + 1 : i;
+    }
+
+    template <typename K>
+    size_type find_index(const K& key) const {
+        size_type i = lower_index(key);
+        return (i != size() && !comp_(key, KeyOf()(data_[i]))) ? i : size();
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> insert_unique(V&& value) {
+        size_type i = lower_index(KeyOf()(value));
+        if(i != size() && !comp_(KeyOf()(value), KeyOf()(data_[i]))){
+            return {begin() + i, false};
+        }
+        data_.insert(begin() + i, std::forward<V>(value));
+        index_.rebuild(data_, KeyOf());
+        return {begin() + i, true};
+    }
+
+    // [first, last) 已按键有序；归并到新数组后整体替换，只分配一次内存
+    template <typename InputIt>
+    void merge_sorted(InputIt first, InputIt last) {
+        if(first == last) return;
+        container_type merged;
+        merged.reserve(data_.size() + static_cast<size_type>(std::distance(first, last)));
+        KeyOf key_of;
+        typename container_type::iterator it = data_.begin();
+        while(first != last){
+            if(it != data_.end() && !comp_(key_of(*first), key_of(*it))){
+                // 已有元素较小或相等：相等时丢弃新元素
+                if(!comp_(key_of(*it), key_of(*first))) ++first;
+                merged.emplace_back(std::move(*it++));
+            }else{
+                // 输入本身可能包含重复键（未去重的区间），只保留第一个
+                if(merged.empty() || comp_(key_of(merged.back()), key_of(*first))){
+                    merged.emplace_back(*first);
+                }
+                ++first;
+            }
+        }
+        for(; it != data_.end(); ++it){
+            merged.emplace_back(std::move(*it));
+        }
+        data_.swap(merged);
+        index_.rebuild(data_, KeyOf());
+    }
+};
+
+} // namespace flat_detail
+
+template <typename Key, typename T, typename Compare = std::less<Key>, typename Layout = sorted_layout,
+          typename Allocator = simple_stl::allocator<std::pair<Key, T>>>
+class flat_map : public flat_detail::flat_tree<Key, std::pair<Key, T>, flat_detail::first_key, Compare, Layout, Allocator>
+{
+    using base = flat_detail::flat_tree<Key, std::pair<Key, T>, flat_detail::first_key, Compare, Layout, Allocator>;
+
+public:
+    using mapped_type = T;
+    using typename base::iterator;
+    using typename base::size_type;
+    using base::base;
+
+    flat_map() = default;
+
+    T& at(const Key& key) {
+        iterator it = this->find(key);
+        if(it == this->end()){
+            throw std::out_of_range("flat_map::at: key not found");
+        }
+        return it->second;
+    }
+    const T& at(const Key& key) const { return const_cast<flat_map*>(this)->at(key); }
+
+    T& operator[](const Key& key) { return try_emplace(key).first->second; }
+    T& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+    // 键已存在时不构造值，args 不会被移动
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return try_emplace_impl(key, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+        std::pair<iterator, bool> res = try_emplace(key, std::forward<M>(obj));
+        if(!res.second) res.first->second = std::forward<M>(obj);
+        return res;
+    }
+
+private:
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_impl(K&& key, Args&&... args) {
+        size_type i = this->lower_index(key);
+        if(i != this->size() && !this->comp_(key, this->data_[i].first)){
+            return {this->begin() + i, false};
+        }
+        this->data_.emplace(this->begin() + i, std::piecewise_construct,
+                            std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        this->index_.rebuild(this->data_, flat_detail::first_key());
+        return {this->begin() + i, true};
+    }
+};
+
+template <typename Key, typename Compare = std::less<Key>, typename Layout = sorted_layout,
+          typename Allocator = simple_stl::allocator<Key>>
+class flat_set : public flat_detail::flat_tree<Key, Key, flat_detail::identity_key, Compare, Layout, Allocator>
+{
+    using base = flat_detail::flat_tree<Key, Key, flat_detail::identity_key, Compare, Layout, Allocator>;
+
+public:
+    using base::base;
+
+    flat_set() = default;
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_FLAT_MAP_H
+
+/**
+ * @note Eytzinger 查找末尾的位运算：向左走记为0、向右走记为1，循环结束时 k 的二进制就是整条路径；
+ * lower_bound 是路径上最后一次向左走的节点，去掉末尾的若干个1以及紧邻的那个0即可（__builtin_ffsll(~k) 正好是这个位数）
+ * @note 默认布局的二分本身已经是无分支的，元素较少（几百个以内）时通常整个数组都在 L1/L2 中，Eytzinger 没有优势；
+ * 元素很多、查找远多于修改时再考虑 eytzinger_layout
+ */
@@ -0,0 +1,263 @@
+/**
+ * @brief 侵入式双向链表：链接指针（hook）作为成员嵌在元素对象内部，链表只负责串联，不分配、不拥有元素
+ * 用法：
+ *   struct Entry { int id; simple_stl::intrusive_list_hook hook; };
+ *   simple_stl::intrusive_list<Entry, &Entry::hook> list;
+ *   list.push_back(entry);   // 不申请内存
+ *   list.erase(entry);       // 只凭对象本身即可 O(1) 摘下
+ * @note 同一个对象如需同时挂在多条链表上，为每条链表各放一个hook成员即可
+ * @note 安全模式（Debug构建默认开启）下会检查：重复插入、删除未挂链的元素、销毁仍挂在链表上的元素
+ */
+#ifndef SIMPLE_STL_CONTAINERS_INTRUSIVE_LIST_H
+#define SIMPLE_STL_CONTAINERS_INTRUSIVE_LIST_H
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "common/iterator.h"
+
+// 未显式指定时跟随 NDEBUG：Debug 构建开启，Release 构建关闭
+#ifndef SIMPLE_STL_INTRUSIVE_SAFE_MODE
+#ifdef NDEBUG
+#define SIMPLE_STL_INTRUSIVE_SAFE_MODE 0
+#else
+#define SIMPLE_STL_INTRUSIVE_SAFE_MODE 1
+#endif
+#endif
+
+#if SIMPLE_STL_INTRUSIVE_SAFE_MODE
+#define SIMPLE_STL_INTRUSIVE_CHECK(cond, msg) assert((cond) && msg)
+#else
+#define SIMPLE_STL_INTRUSIVE_CHECK(cond, msg) ((void)0)
+#endif
+
+namespace simple_stl {
+
+// 嵌入到元素中的链接钩子，未挂链时prev/next均为nullptr
+class intrusive_list_hook
+{
+public:
+    intrusive_list_hook() noexcept : prev_(nullptr), next_(nullptr) {}
+
+    // 拷贝元素时不拷贝链接关系：新对象总是处于未挂链状态
+    intrusive_list_hook(const intrusive_list_hook&) noexcept : prev_(nullptr), next_(nullptr) {}
+    intrusive_list_hook& operator=(const intrusive_list_hook&) noexcept { return *this; }
+
+    ~intrusive_list_hook() {
+        SIMPLE_STL_INTRUSIVE_CHECK(!is_linked(), "intrusive_list: element destroyed while still linked");
+    }
+
+    bool is_linked() const noexcept { return next_ != nullptr; }
+
+private:
+    template <typename T, intrusive_list_hook T::*Member>
+    friend class intrusive_list;
+
+    intrusive_list_hook* prev_;
+    intrusive_list_hook* next_;
+};
+
+// intrusive_list<T, &T::hook>：Member 是元素中 intrusive_list_hook 成员的成员指针
+template <typename T, intrusive_list_hook T::*Member>
+class intrusive_list
+{
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = simple_stl::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        Iterator() noexcept : current_(nullptr) {}
+        // 普通迭代器可以隐式转换为常量迭代器
+        template <bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false>& other) noexcept : current_(other.current_) {}
+
+        reference operator*() const noexcept { return *to_value(current_); }
+        pointer operator->() const noexcept { return to_value(current_); }
+
+        Iterator& operator++() noexcept { current_ = current_->next_; return *this; }
+        Iterator operator++(int) noexcept { Iterator temp = *this; current_ = current_->next_; return temp; }
+        Iterator& operator--() noexcept { current_ = current_->prev_; return *this; }
+        Iterator operator--(int) noexcept { Iterator temp = *this; current_ = current_->prev_; return temp; }
+
+        bool operator==(const Iterator& other) const noexcept { return current_ == other.current_; }
+        bool operator!=(const Iterator& other) const noexcept { return current_ != other.current_; }
+
+    private:
+        friend class intrusive_list;
+        template <bool> friend class Iterator;
+        explicit Iterator(intrusive_list_hook* node) noexcept : current_(node) {}
+
+        intrusive_list_hook* current_;
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    intrusive_list() noexcept : size_(0) { reset(); }
+
+    // 链表不拥有元素，拷贝没有意义；移动只需转移哨兵上的链接
+    intrusive_list(const intrusive_list&) = delete;
+    intrusive_list& operator=(const intrusive_list&) = delete;
+
+    intrusive_list(intrusive_list&& other) noexcept : size_(0) {
+        reset();
+        swap(other);
+    }
+
+    intrusive_list& operator=(intrusive_list&& other) noexcept {
+        if(this != &other){
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    // 析构时只把元素的hook置为未挂链状态，元素本身由使用者管理
+    ~intrusive_list() {
+        clear();
+        head_.prev_ = nullptr; // 哨兵也置为未挂链，避免安全模式下hook析构时误报
+        head_.next_ = nullptr;
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    reference front() noexcept { return *to_value(head_.next_); }
+    const_reference front() const noexcept { return *to_value(head_.next_); }
+    reference back() noexcept { return *to_value(head_.prev_); }
+    const_reference back() const noexcept { return *to_value(head_.prev_); }
+
+    iterator begin() noexcept { return iterator(head_.next_); }
+    iterator end() noexcept { return iterator(&head_); }
+    const_iterator begin() const noexcept { return const_iterator(head_.next_); }
+    const_iterator end() const noexcept { return const_iterator(const_cast<intrusive_list_hook*>(&head_)); }
+
+    // 由元素直接得到迭代器 O(1)
+    iterator iterator_to(T& value) noexcept { return iterator(&(value.*Member)); }
+    const_iterator iterator_to(const T& value) const noexcept {
+        return const_iterator(const_cast<intrusive_list_hook*>(&(value.*Member)));
+    }
+
+    void push_back(T& value) noexcept { link_before(&head_, &(value.*Member)); }
+    void push_front(T& value) noexcept { link_before(head_.next_, &(value.*Member)); }
+
+    // 在pos之前插入，返回指向value的迭代器
+    iterator insert(const_iterator pos, T& value) noexcept {
+        link_before(pos.current_, &(value.*Member));
+        return iterator(&(value.*Member));
+    }
+
+    void pop_front() noexcept { erase(begin()); }
+    void pop_back() noexcept { erase(iterator(head_.prev_)); }
+
+    iterator erase(const_iterator pos) noexcept {
+        intrusive_list_hook* next = pos.current_->next_;
+        unlink(pos.current_);
+        return iterator(next);
+    }
+
+    // 只凭元素本身即可从链表摘下 O(1)，value 必须挂在当前链表上
+    void erase(T& value) noexcept { unlink(&(value.*Member)); }
+
+    void clear() noexcept {
+        intrusive_list_hook* curr = head_.next_;
+        while(curr != &head_){
+            intrusive_list_hook* next = curr->next_;
+            curr->prev_ = nullptr;
+            curr->next_ = nullptr;
+            curr = next;
+        }
+        reset();
+    }
+
+    // 将other的全部元素挂到pos之前 O(1)
+    void splice(const_iterator pos, intrusive_list& other) noexcept {
+        if(this == &other || other.empty()) return;
+        intrusive_list_hook* first = other.head_.next_;
+        intrusive_list_hook* last = other.head_.prev_;
+        intrusive_list_hook* p = pos.current_;
+        first->prev_ = p->prev_;
+        p->prev_->next_ = first;
+        last->next_ = p;
+        p->prev_ = last;
+        size_ += other.size_;
+        other.reset();
+    }
+
+    void swap(intrusive_list& other) noexcept {
+        std::swap(head_.prev_, other.head_.prev_);
+        std::swap(head_.next_, other.head_.next_);
+        std::swap(size_, other.size_);
+        fix_sentinel();
+        other.fix_sentinel();
+    }
+
+private:
+    intrusive_list_hook head_; // 哨兵，不属于任何元素
+    size_type size_;
+
+    // 由hook地址反推所在元素的地址：hook在T中的偏移量由成员指针在一块未构造的对齐内存上计算得到
+    static std::ptrdiff_t hook_offset() noexcept {
+        alignas(T) static unsigned char storage[sizeof(T)];
+        const T* fake = reinterpret_cast<const T*>(storage);
+        return reinterpret_cast<const unsigned char*>(&(fake->*Member)) - reinterpret_cast<const unsigned char*>(fake);
+    }
+
+    static T* to_value(intrusive_list_hook* node) noexcept {
+        return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(node) - hook_offset());
+    }
+
+    void reset() noexcept {
+        head_.prev_ = &head_;
+        head_.next_ = &head_;
+        size_ = 0;
+    }
+
+    void fix_sentinel() noexcept {
+        if(size_ == 0){
+            reset();
+        }else{
+            head_.next_->prev_ = &head_;
+            head_.prev_->next_ = &head_;
+        }
+    }
+
+    void link_before(intrusive_list_hook* pos, intrusive_list_hook* node) noexcept {
+        SIMPLE_STL_INTRUSIVE_CHECK(!node->is_linked(), "intrusive_list: element is already linked");
+        intrusive_list_hook* prev = pos->prev_;
+        node->prev_ = prev;
+        node->next_ = pos;
+        prev->next_ = node;
+        pos->prev_ = node;
+        ++size_;
+    }
+
+    void unlink(intrusive_list_hook* node) noexcept {
+        SIMPLE_STL_INTRUSIVE_CHECK(node->is_linked() && node != &head_, "intrusive_list: element is not linked");
+        node->prev_->next_ = node->next_;
+        node->next_->prev_ = node->prev_;
+        node->prev_ = nullptr; // 摘下后恢复未挂链状态，is_linked() 可用于判断
+        node->next_ = nullptr;
+        --size_;
+    }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_INTRUSIVE_LIST_H
+
+/**
+ * @note 与 List 的对比：List 每插入一个元素都要申请一个 ListNode 并拷贝/移动元素；
+ * 侵入式链表的“节点”就是元素自己，插入删除只改4个指针，元素地址天然稳定
+ * @note 成员指针 intrusive_list_hook T::*Member 作为非类型模板参数，编译期即确定hook在T中的位置，运行时没有额外存储
+ */
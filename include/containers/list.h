@@ -2,6 +2,11 @@
 #define SIMPLE_STL_CONTAINERS_LIST_H
 
 #include <cstddef> // ptrdiff_t 用于表示两个指针之间的差值
+#include <functional> // std::less, std::equal_to
+#include <initializer_list>
+#include <stdexcept> // std::out_of_range
+#include <type_traits> // std::enable_if, std::is_integral
+#include <utility> // std::move, std::forward, std::swap
 #include "common/iterator.h"
 #include "common/allocator.h"
 
@@ -10,21 +15,42 @@ namespace simple_stl {
 template <typename T, typename Allocator> // 前置声明中不要重复指定默认值
 class List;
 
+// 链表节点只与元素类型有关、与分配器无关，放在命名空间作用域，使用任意分配器的 List 共享同一套迭代器
+// 只负责链接关系的基类节点，哨兵就是一个ListNodeBase，不包含T
+struct ListNodeBase{
+    ListNodeBase* prev = nullptr;
+    ListNodeBase* next = nullptr;
+};
+
 template <typename T>
+struct ListNode : ListNodeBase{
+    T data;
+    // 元素由参数原地构造，不经过任何临时T对象
+    template <typename... Args>
+    explicit ListNode(Args&&... args) : data(std::forward<Args>(args)...) {}
+};
+
+// IsConst 为 true 时是常量迭代器：解引用得到 const T&
+template <typename T, bool IsConst = false>
 class ListIterator
 {
 public:
     using iterator_category = simple_stl::bidirectional_iterator_tag; // 双向迭代器
     using difference_type = std::ptrdiff_t;
     using value_type = T;
-    using pointer = T*;
-    using reference = T&;
+    using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+    using reference = typename std::conditional<IsConst, const T&, T&>::type;
 
-    ListIterator(typename simple_stl::List<T,simple_stl::allocator<T>>::ListNode* node = nullptr):current_(node) {}
+    ListIterator() noexcept : current_(nullptr) {}
+    explicit ListIterator(ListNodeBase* node) noexcept : current_(node) {}
+
+    // 普通迭代器可以隐式转换为常量迭代器，反之不行
+    template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+    ListIterator(const ListIterator<T, false>& other) noexcept : current_(other.current_) {}
 
     // 解引用，自增，自减
-    reference operator*() const { return current_->data; }
-    pointer operator->() const { return &(current_->data); }
+    reference operator*() const { return static_cast<ListNode<T>*>(current_)->data; }
+    pointer operator->() const { return &(static_cast<ListNode<T>*>(current_)->data); }
 
     ListIterator& operator++() { // 前置++
         current_ = current_->next;
@@ -47,29 +73,42 @@ public:
         return temp;
     }
 
-    // 相等/不等比较
-    bool operator==(const ListIterator& other) const {
-        return current_ == other.current_;
+    // 相等/不等比较：定义为友元，iterator 与 const_iterator 混合比较时可以隐式转换
+    friend bool operator==(const ListIterator& a, const ListIterator& b) noexcept {
+        return a.current_ == b.current_;
     }
 
-    bool operator!=(const ListIterator& other) const {
-        return !(*this == other);
+    friend bool operator!=(const ListIterator& a, const ListIterator& b) noexcept {
+        return !(a == b);
     }
 private:
-    typename simple_stl::List<T, simple_stl::allocator<T>>::ListNode* current_;
+    template <typename U, typename A>
+    friend class List; // insert/erase/splice 需要直接拿到迭代器所指节点
+    template <typename U, bool C>
+    friend class ListIterator;
+
+    // 指向不带数据的基类节点，end()指向的哨兵只有prev/next，解引用时再转换回ListNode
+    ListNodeBase* current_;
 };
 
 template <typename T, typename Allocator = simple_stl::allocator<T>>
-class List 
+class List
 {
 private:
-    struct  ListNode; // 前置声明
-    
+    using Node = ListNode<T>;
+
 public:
+    using value_type = T;
+    using allocator_type = Allocator;
     using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
     using iterator = ListIterator<T>;
-    using const_iterator = ListIterator<T>;  // 为简化逻辑，这里省略了常量迭代器的实现，先调用普通迭代器
-    using NodeAllocator = typename Allocator::template rebind<ListNode>::other;
+    using const_iterator = ListIterator<T, true>;
+    using reverse_iterator = simple_stl::reverse_iterator<iterator>;
+    using const_reverse_iterator = simple_stl::reverse_iterator<const_iterator>;
+    using NodeAllocator = typename Allocator::template rebind<Node>::other;
 
     // 构造函数
 
@@ -79,119 +118,449 @@ public:
     }
 
     // 用迭代[b,e)区间内的元素构造
-    template <typename InputIterator>
-    List(InputIterator b, InputIterator e,const Allocator& alloc = Allocator()):node_alloc_(alloc){ 
+    template <typename InputIterator,
+              typename std::enable_if<!std::is_integral<InputIterator>::value, int>::type = 0>
+    List(InputIterator b, InputIterator e,const Allocator& alloc = Allocator()):node_alloc_(alloc){
         initDummy();
-        while (b != e)
+        try
         {
-            push_back(*b);
-            ++b; // 前自增无需额外复制迭代器，循环效率更高；只有“需要先用当前值，再增加”时使用后自增
+            while (b != e)
+            {
+                push_back(*b);
+                ++b; // 前自增无需额外复制迭代器，循环效率更高；只有“需要先用当前值，再增加”时使用后自增
+            }
+        }
+        catch(...)
+        {
+            clear(); // 构造函数抛出异常时析构函数不会执行，需要自行释放已构造的节点
+            throw;
         }
     }
 
     // 初始化有n个值为 elem的节点的链表
     List(int n, const T& elem, const Allocator& alloc = Allocator()):node_alloc_(alloc) {
         initDummy();
-        for (int i = 0; i < n; ++i) {
-            push_back(elem); 
+        try
+        {
+            for (int i = 0; i < n; ++i) {
+                push_back(elem);
+            }
+        }
+        catch(...)
+        {
+            clear();
+            throw;
         }
     }
 
+    List(std::initializer_list<T> il, const Allocator& alloc = Allocator())
+        : List(il.begin(), il.end(), alloc) {}
+
     // 拷贝构造 无需冗余夹带模版参数
     List(const List& other):node_alloc_(other.node_alloc_){
         initDummy();
-        auto it = other.begin();
-        auto end = other.end();
-        while(it != end){
-            push_back(*it);
-            ++it;
+        try
+        {
+            auto it = other.begin();
+            auto end = other.end();
+            while(it != end){
+                push_back(*it);
+                ++it;
+            }
+        }
+        catch(...)
+        {
+            clear();
+            throw;
+        }
+    }
+
+    // 移动构造：哨兵内嵌在对象中不需要申请内存，先置空再交换即可
+    List(List&& other) noexcept :node_alloc_(other.node_alloc_){
+        initDummy();
+        swap(other);
+    }
+
+    // 拷贝赋值：拷贝构造临时对象 + swap，旧节点随临时对象析构
+    List& operator=(const List& other) {
+        if(this != &other){
+            List temp(other);
+            swap(temp);
         }
+        return *this;
+    }
+
+    List& operator=(List&& other) noexcept {
+        if(this != &other){
+            clear();
+            swap(other);
+        }
+        return *this;
     }
 
     // 析构函数
     ~List() {
-        
-        ListNode* curr = head_->next; 
-        while (curr != head_) {      
-            ListNode* next = curr->next;  
-            destroyNode(curr);            
-            curr = next;                  
+        clear();
+    }
+
+    // 哨兵是成员对象，交换prev/next后还需要把首尾节点重新指向各自的哨兵
+    void swap(List& other) noexcept {
+        std::swap(head_.prev, other.head_.prev);
+        std::swap(head_.next, other.head_.next);
+        std::swap(m_size_, other.m_size_);
+        std::swap(node_alloc_, other.node_alloc_);
+        fixSentinel();
+        other.fixSentinel();
+    }
+
+    // 容量
+    size_type size() const noexcept { return m_size_; }
+    bool empty() const noexcept { return m_size_ == 0; }
+
+    // 元素访问（空链表上调用属于未定义行为，与std::list一致）
+    reference front() { return valueOf(head_.next); }
+    const_reference front() const { return valueOf(head_.next); }
+    reference back() { return valueOf(head_.prev); }
+    const_reference back() const { return valueOf(head_.prev); }
+
+    // 插入、删除操作
+    void push_back(const T& val) { emplace_back(val); }
+    void push_back(T&& val) { emplace_back(std::move(val)); }
+    void push_front(const T& val) { emplace_front(val); }
+    void push_front(T&& val) { emplace_front(std::move(val)); }
+
+    // 参数直接转发给元素的构造函数，move-only 类型也可以放入链表
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        // 默认：链表不为空的时候，哨兵头结点的前指针指向尾节点；链表为空时，头结点的prev和next都指向自己
+        ListNodeBase* newNode = createNode(std::forward<Args>(args)...);
+        linkBefore(&head_, newNode);
+        return valueOf(newNode);
+    }
+
+    template <typename... Args>
+    reference emplace_front(Args&&... args) {
+        ListNodeBase* newNode = createNode(std::forward<Args>(args)...);
+        linkBefore(head_.next, newNode);
+        return valueOf(newNode);
+    }
+
+    // 在pos之前构造新元素，返回指向新元素的迭代器
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        ListNodeBase* newNode = createNode(std::forward<Args>(args)...);
+        linkBefore(pos.current_, newNode);
+        return iterator(newNode);
+    }
+
+    iterator insert(const_iterator pos, const T& val) { return emplace(pos, val); }
+    iterator insert(const_iterator pos, T&& val) { return emplace(pos, std::move(val)); }
+
+    iterator insert(const_iterator pos, size_type n, const T& val) {
+        // 先在临时链表中构造好再整体拼接，任何一个元素构造失败都不会影响当前链表
+        List temp(node_alloc_);
+        for(size_type i = 0; i < n; ++i){
+            temp.push_back(val);
+        }
+        return spliceAll(pos, temp);
+    }
+
+    template <typename InputIterator,
+              typename std::enable_if<!std::is_integral<InputIterator>::value, int>::type = 0>
+    iterator insert(const_iterator pos, InputIterator b, InputIterator e) {
+        List temp(b, e, node_alloc_);
+        return spliceAll(pos, temp);
+    }
+
+    // 删除pos指向的元素，返回被删元素的下一个位置
+    iterator erase(const_iterator pos) {
+        ListNodeBase* node = pos.current_;
+        ListNodeBase* next = node->next;
+        unlink(node);
+        destroyNode(node);
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        while(first != last){
+            first = erase(first);
         }
+        return iterator(last.current_);
+    }
 
-        destroyNode(head_);
+    void pop_back() {
+        if(empty()){
+            throw std::out_of_range("List::pop_back: container is empty!");
+        }
+        erase(iterator(head_.prev));
+    }
 
-        head_ = nullptr;
+    void pop_front() {
+        if(empty()){
+            throw std::out_of_range("List::pop_front: container is empty!");
+        }
+        erase(iterator(head_.next));
+    }
+
+    void clear() noexcept {
+        ListNodeBase* curr = head_.next;
+        while (curr != &head_) {
+            ListNodeBase* next = curr->next;
+            destroyNode(curr);
+            curr = next;
+        }
+        head_.next = &head_;
+        head_.prev = &head_;
         m_size_ = 0;
     }
 
-    // 插入、删除操作
-    void push_back(const T& val) {
-       
-        ListNode* newNode = createNode(val);
+    void resize(size_type n) {
+        while(m_size_ > n) pop_back();
+        while(m_size_ < n) emplace_back();
+    }
 
-        // 默认：链表不为空的时候，哨兵头结点的前指针指向尾节点；链表为空时，头结点的prev和next都指向自己
-        ListNode* last = head_->prev;
-        newNode->prev = last;
-        newNode->next = head_;
-        last->next = newNode;
-        head_->prev = newNode;
-        m_size_++;
+    void resize(size_type n, const T& val) {
+        while(m_size_ > n) pop_back();
+        while(m_size_ < n) push_back(val);
+    }
+
+    /*    ********************** 节点重链接操作：不构造/拷贝任何元素 **********************     */
+
+    // 将other的全部节点移动到pos之前 O(1)
+    void splice(const_iterator pos, List& other) {
+        if(this != &other){
+            spliceAll(pos, other);
+        }
+    }
+    void splice(const_iterator pos, List&& other) { splice(pos, other); }
+
+    // 将other中it指向的单个节点移动到pos之前 O(1)
+    void splice(const_iterator pos, List& other, const_iterator it) {
+        ListNodeBase* node = it.current_;
+        if(node == pos.current_ || node->next == pos.current_) return; // 原地不动
+        other.unlink(node);
+        linkBefore(pos.current_, node);
+    }
+    void splice(const_iterator pos, List&& other, const_iterator it) { splice(pos, other, it); }
+
+    // 将other中[first, last)移动到pos之前；同一链表内 O(1)，跨链表需要 O(n) 统计节点数以维护size()
+    void splice(const_iterator pos, List& other, const_iterator first, const_iterator last) {
+        if(first == last) return;
+        if(this != &other){
+            size_type n = 0;
+            for(const_iterator it = first; it != last; ++it) ++n;
+            other.m_size_ -= n;
+            m_size_ += n;
+        }
+        transfer(pos.current_, first.current_, last.current_);
+    }
+    void splice(const_iterator pos, List&& other, const_iterator first, const_iterator last) {
+        splice(pos, other, first, last);
+    }
+
+    // 合并两个有序链表，稳定：相等元素中当前链表的元素排在前面
+    void merge(List& other) { merge(other, std::less<T>()); }
+    void merge(List&& other) { merge(other, std::less<T>()); }
+
+    template <typename Compare>
+    void merge(List& other, Compare comp) {
+        if(this == &other) return;
+        ListNodeBase* a = head_.next;
+        ListNodeBase* b = other.head_.next;
+        while(a != &head_ && b != &other.head_){
+            if(comp(valueOf(b), valueOf(a))){
+                ListNodeBase* next = b->next;
+                transfer(a, b, next);
+                b = next;
+            }else{
+                a = a->next;
+            }
+        }
+        if(b != &other.head_){
+            transfer(&head_, b, &other.head_);
+        }
+        m_size_ += other.m_size_;
+        other.m_size_ = 0;
+    }
+    template <typename Compare>
+    void merge(List&& other, Compare comp) { merge(other, comp); }
+
+    // 原地稳定排序：自底向上归并，不申请任何额外内存
+    void sort() { sort(std::less<T>()); }
+
+    template <typename Compare>
+    void sort(Compare comp) {
+        if(m_size_ < 2) return;
+
+        // 断开环，按单链表处理，排完后再恢复prev指针
+        head_.prev->next = nullptr;
+        ListNodeBase* rest = head_.next;
+
+        // bins[i] 保存长度为 2^i 的有序段（或为空），过程类似二进制计数器的进位
+        const int kMaxBins = 64;
+        ListNodeBase* bins[kMaxBins] = {};
+        int fill = 0;
+        while(rest){
+            ListNodeBase* carry = rest;
+            rest = rest->next;
+            carry->next = nullptr;
+            int i = 0;
+            for(; i < fill && bins[i]; ++i){
+                carry = mergeRuns(bins[i], carry, comp); // bins[i] 更早进入，放在前面保证稳定
+                bins[i] = nullptr;
+            }
+            if(i == kMaxBins) --i;
+            bins[i] = carry;
+            if(i == fill) ++fill;
+        }
+        ListNodeBase* result = nullptr;
+        for(int i = 0; i < fill; ++i){
+            if(bins[i]){
+                result = result ? mergeRuns(bins[i], result, comp) : bins[i];
+            }
+        }
+
+        // 恢复双向环形结构
+        ListNodeBase* prev = &head_;
+        for(ListNodeBase* curr = result; curr; curr = curr->next){
+            curr->prev = prev;
+            prev->next = curr;
+            prev = curr;
+        }
+        prev->next = &head_;
+        head_.prev = prev;
+    }
+
+    // val 可能引用链表中的某个元素，该节点要留到最后再删除
+    size_type remove(const T& val) {
+        size_type removed = 0;
+        ListNodeBase* deferred = nullptr;
+        ListNodeBase* curr = head_.next;
+        while(curr != &head_){
+            ListNodeBase* next = curr->next;
+            if(valueOf(curr) == val){
+                if(&valueOf(curr) == &val){
+                    deferred = curr;
+                }else{
+                    unlink(curr);
+                    destroyNode(curr);
+                }
+                ++removed;
+            }
+            curr = next;
+        }
+        if(deferred){
+            unlink(deferred);
+            destroyNode(deferred);
+        }
+        return removed;
+    }
+
+    template <typename Predicate>
+    size_type remove_if(Predicate pred) {
+        size_type removed = 0;
+        ListNodeBase* curr = head_.next;
+        while(curr != &head_){
+            ListNodeBase* next = curr->next;
+            if(pred(valueOf(curr))){
+                unlink(curr);
+                destroyNode(curr);
+                ++removed;
+            }
+            curr = next;
+        }
+        return removed;
+    }
+
+    // 删除连续重复元素中除第一个以外的元素
+    size_type unique() { return unique(std::equal_to<T>()); }
+
+    template <typename BinaryPredicate>
+    size_type unique(BinaryPredicate pred) {
+        size_type removed = 0;
+        if(m_size_ < 2) return removed;
+        ListNodeBase* first = head_.next;
+        ListNodeBase* curr = first->next;
+        while(curr != &head_){
+            ListNodeBase* next = curr->next;
+            if(pred(valueOf(first), valueOf(curr))){
+                unlink(curr);
+                destroyNode(curr);
+                ++removed;
+            }else{
+                first = curr;
+            }
+            curr = next;
+        }
+        return removed;
+    }
+
+    // 交换每个节点（含哨兵）的前后指针即可完成反转
+    void reverse() noexcept {
+        ListNodeBase* curr = &head_;
+        do{
+            std::swap(curr->prev, curr->next);
+            curr = curr->prev; // 交换后prev是原来的next
+        }while(curr != &head_);
     }
 
     // begin、end迭代器
     iterator begin() noexcept {
-        return iterator(head_->next);
+        return iterator(head_.next);
     }
     iterator end() noexcept {
-        return iterator(head_); 
+        return iterator(&head_);
     }
 
     const_iterator begin() const noexcept {
-        return const_iterator(head_->next);
+        return const_iterator(head_.next);
     }
     const_iterator end() const noexcept {
-        return const_iterator(head_);
+        // 迭代器内部统一保存非常量节点指针，常量性由 reference 类型体现
+        return const_iterator(const_cast<ListNodeBase*>(&head_));
     }
-    
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
 
-private:
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
 
-    template <typename U>
-    friend class ListIterator;
 
-    struct ListNode{
-        T data;
-        ListNode* prev;
-        ListNode* next;
-        ListNode(const T& val):data(val),prev(nullptr),next(nullptr) {}
-        ListNode(const T& val, ListNode* p, ListNode* n) : data(val), prev(p), next(n) {}
-    };
+private:
 
-    ListNode* head_;
+    ListNodeBase head_; // 哨兵：链表为空时prev/next都指向自己
     size_type m_size_;
-    NodeAllocator node_alloc_; 
+    NodeAllocator node_alloc_;
 
-    void initDummy(){
-        ListNode* dummy = node_alloc_.allocate(1);
-        try
-        {
-            // 参数含义 内存地址、(构造ListNode用的)data,prev,next
-            node_alloc_.construct(dummy, T(), dummy, dummy);
-        }
-        catch(...)
-        {
-            node_alloc_.deallocate(dummy, 1);
-            throw;
-        }
-        head_ = dummy;
+    static T& valueOf(ListNodeBase* p) noexcept {
+        return static_cast<Node*>(p)->data;
+    }
+
+    void initDummy() noexcept {
+        head_.prev = &head_;
+        head_.next = &head_;
         m_size_ = 0;
     }
 
-    ListNode* createNode(const T& val){
-        ListNode* node = node_alloc_.allocate(1);
+    void fixSentinel() noexcept {
+        if(m_size_ == 0){
+            initDummy();
+        }else{
+            head_.next->prev = &head_;
+            head_.prev->next = &head_;
+        }
+    }
+
+    template <typename... Args>
+    ListNodeBase* createNode(Args&&... args){
+        Node* node = node_alloc_.allocate(1);
         try
         {
-            node_alloc_.construct(node, val, nullptr, nullptr);
+            node_alloc_.construct(node, std::forward<Args>(args)...);
         }
         catch(...)
         {
@@ -201,12 +570,97 @@ private:
         return node;
     }
 
-    void destroyNode(ListNode* p){
+    void destroyNode(ListNodeBase* p){
         if(p == nullptr) return;
-        node_alloc_.destroy(p); // 先析构对象
-        node_alloc_.deallocate(p, 1);
+        Node* node = static_cast<Node*>(p);
+        node_alloc_.destroy(node); // 先析构对象
+        node_alloc_.deallocate(node, 1);
+    }
+
+    // 把node挂到pos之前
+    void linkBefore(ListNodeBase* pos, ListNodeBase* node) noexcept {
+        ListNodeBase* prev = pos->prev;
+        node->prev = prev;
+        node->next = pos;
+        prev->next = node;
+        pos->prev = node;
+        ++m_size_;
+    }
+
+    // 把node从链表上摘下（不释放）
+    void unlink(ListNodeBase* node) noexcept {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        --m_size_;
+    }
+
+    // 把[first, last)整体挪到pos之前，只修改6个指针，不维护size
+    static void transfer(ListNodeBase* pos, ListNodeBase* first, ListNodeBase* last) noexcept {
+        if(pos == last) return;
+        ListNodeBase* tail = last->prev;
+        // 从原位置摘下
+        first->prev->next = last;
+        last->prev = first->prev;
+        // 挂到pos之前
+        ListNodeBase* prev = pos->prev;
+        prev->next = first;
+        first->prev = prev;
+        tail->next = pos;
+        pos->prev = tail;
+    }
+
+    iterator spliceAll(const_iterator pos, List& other) noexcept {
+        ListNodeBase* first = other.head_.next;
+        if(other.empty()) return iterator(pos.current_);
+        transfer(pos.current_, first, &other.head_);
+        m_size_ += other.m_size_;
+        other.m_size_ = 0;
+        return iterator(first);
+    }
+
+    // 归并两段以nullptr结尾的有序单链，相等时a在前
+    // 用指向next指针的二级指针作为写入位置，省去一个需要构造T的临时头结点
+    template <typename Compare>
+    static ListNodeBase* mergeRuns(ListNodeBase* a, ListNodeBase* b, Compare& comp) {
+        ListNodeBase* result = nullptr;
+        ListNodeBase** tail = &result;
+        while(a && b){
+            if(comp(valueOf(b), valueOf(a))){
+                *tail = b;
+                b = b->next;
+            }else{
+                *tail = a;
+                a = a->next;
+            }
+            tail = &((*tail)->next);
+        }
+        *tail = a ? a : b;
+        return result;
     }
 };
 
+template <typename T, typename Allocator>
+bool operator==(const List<T, Allocator>& lhs, const List<T, Allocator>& rhs) {
+    if(lhs.size() != rhs.size()) return false;
+    auto a = lhs.begin();
+    auto b = rhs.begin();
+    for(; a != lhs.end(); ++a, ++b){
+        if(!(*a == *b)) return false;
+    }
+    return true;
+}
+
+template <typename T, typename Allocator>
+bool operator!=(const List<T, Allocator>& lhs, const List<T, Allocator>& rhs) {
+    return !(lhs == rhs);
+}
+
 } // namespace simple_stl
-#endif // SIMPLE_STL_CONTAINERS_LIST_H
\ No newline at end of file
+#endif // SIMPLE_STL_CONTAINERS_LIST_H
+
+/**
+ * @note splice/merge/sort 全部通过修改节点指针完成，元素本身既不拷贝也不移动，
+ * 原有迭代器和元素地址在操作后依然有效
+ * @note sort 中的 bins 数组是“二进制计数器”：第i个桶里放长度为2^i的有序段，新节点进来后逐级与桶中已有段合并进位，
+ * 最多只需要 log2(n) 个桶，整个过程只用栈上的64个指针
+ */
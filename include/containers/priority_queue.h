@@ -0,0 +1,333 @@
+/**
+ * @brief d 叉堆实现的优先队列，元素连续存放在 simple_stl::vector 中
+ *   下标 i 的父节点为 (i - 1) / D，子节点为 D*i + 1 ... D*i + D
+ *   D 取4（默认）时树高只有二叉堆的一半，一个节点的4个子节点通常落在同一条缓存行里，
+ *   pop 时比较次数略多，但访存次数少，整体比二叉堆更快
+ * 与 std::priority_queue 一致：Compare 为 std::less 时是大顶堆，top() 是最大元素；用 std::greater 得到小顶堆
+ *
+ * priority_queue          —— 普通堆，push/pop O(log n)，另有 replace_top 用于 top-K（替换堆顶只需一次下沉）
+ * indexed_priority_queue  —— push 返回句柄，可以通过句柄 O(log n) 地修改优先级（decrease-key）或删除任意元素
+ */
+#ifndef SIMPLE_STL_CONTAINERS_PRIORITY_QUEUE_H
+#define SIMPLE_STL_CONTAINERS_PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "containers/vector.h"
+
+namespace simple_stl {
+
+template <typename T, typename Compare = std::less<T>, std::size_t D = 4>
+class priority_queue
+{
+    static_assert(D >= 2, "heap arity must be at least 2");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using value_compare = Compare;
+
+    priority_queue(const Compare& comp = Compare()) : comp_(comp) {}
+
+    // 先整体放入再自底向上建堆，O(n)，比逐个 push 的 O(n log n) 快
+    template <typename InputIt>
+    priority_queue(InputIt first, InputIt last, const Compare& comp = Compare()) : comp_(comp) {
+        for(; first != last; ++first) heap_.push_back(*first);
+        make_heap();
+    }
+
+    bool empty() const noexcept { return heap_.empty(); }
+    size_type size() const noexcept { return heap_.size(); }
+    void reserve(size_type n) { heap_.reserve(n); }
+    void clear() noexcept { heap_.clear(); }
+
+    const_reference top() const {
+        if(heap_.empty()){
+            throw std::out_of_range("priority_queue::top: queue is empty!");
+        }
+        return heap_.front();
+    }
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        heap_.emplace_back(std::forward<Args>(args)...);
+        sift_up(heap_.size() - 1);
+    }
+
+    void pop() {
+        if(heap_.empty()){
+            throw std::out_of_range("priority_queue::pop: queue is empty!");
+        }
+        if(heap_.size() > 1) heap_.front() = std::move(heap_.back());
+        heap_.pop_back();
+        if(!heap_.empty()) sift_down(0);
+    }
+
+    // 取出堆顶（移动而不是拷贝）并弹出
+    T take_top() {
+        if(heap_.empty()){
+            throw std::out_of_range("priority_queue::take_top: queue is empty!");
+        }
+        T value = std::move(heap_.front());
+        pop();
+        return value;
+    }
+
+    // 用 value 替换堆顶：等价于 pop + push，但只做一次下沉
+    // top-K：维护大小为 K 的小顶堆，新元素比堆顶大时 replace_top
+    void replace_top(T value) {
+        if(heap_.empty()){
+            throw std::out_of_range("priority_queue::replace_top: queue is empty!");
+        }
+        heap_.front() = std::move(value);
+        sift_down(0);
+    }
+
+    void swap(priority_queue& other) noexcept {
+        heap_.swap(other.heap_);
+        std::swap(comp_, other.comp_);
+    }
+
+private:
+    simple_stl::vector<T> heap_;
+    Compare comp_;
+
+    void make_heap() {
+        size_type n = heap_.size();
+        if(n < 2) return;
+        for(size_type i = (n - 2) / D + 1; i-- > 0;) sift_down(i);
+    }
+
+    // “空穴”上浮：先把元素拿出来，沿途把父节点往下移，最后一次性放到位，省去逐层 swap
+    void sift_up(size_type i) {
+        T value = std::move(heap_[i]);
+        while(i > 0){
+            size_type parent = (i - 1) / D;
+            if(!comp_(heap_[parent], value)) break;
+            heap_[i] = std::move(heap_[parent]);
+            i = parent;
+        }
+        heap_[i] = std::move(value);
+    }
+
+    void sift_down(size_type i) {
+        size_type n = heap_.size();
+        T value = std::move(heap_[i]);
+        while(true){
+            size_type first = D * i + 1;
+            if(first >= n) break;
+            size_type last = first + D < n ? first + D : n;
+            size_type best = first;
+            for(size_type c = first + 1; c < last; ++c){
+                if(comp_(heap_[best], heap_[c])) best = c;
+            }
+            if(!comp_(value, heap_[best])) break;
+            heap_[i] = std::move(heap_[best]);
+            i = best;
+        }
+        heap_[i] = std::move(value);
+    }
+};
+
+/**
+ * @brief 可索引的 d 叉堆：每个元素有一个稳定的句柄（handle），句柄在元素被 pop/erase 之前一直有效
+ *   heap_  : 堆数组，存放 {元素, 句柄}，比较只访问这个连续数组
+ *   pos_   : 句柄 -> 元素在 heap_ 中的下标，堆中每移动一次元素同步更新；空闲句柄记为 npos
+ *   free_  : 回收的句柄，push 时优先复用
+ * @note 句柄在元素移除后会被复用，持有旧句柄的一方应该用 contains() 加上对值的比较来确认它仍然指向原来的元素
+ */
+template <typename T, typename Compare = std::less<T>, std::size_t D = 4>
+class indexed_priority_queue
+{
+    static_assert(D >= 2, "heap arity must be at least 2");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using handle = std::size_t;
+    using const_reference = const T&;
+    using value_compare = Compare;
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    indexed_priority_queue(const Compare& comp = Compare()) : comp_(comp) {}
+
+    bool empty() const noexcept { return heap_.empty(); }
+    size_type size() const noexcept { return heap_.size(); }
+    void reserve(size_type n) {
+        heap_.reserve(n);
+        pos_.reserve(n);
+    }
+    void clear() noexcept {
+        heap_.clear();
+        pos_.clear();
+        free_.clear();
+    }
+
+    const_reference top() const {
+        if(heap_.empty()){
+            throw std::out_of_range("indexed_priority_queue::top: queue is empty!");
+        }
+        return heap_.front().value;
+    }
+    handle top_handle() const {
+        if(heap_.empty()){
+            throw std::out_of_range("indexed_priority_queue::top_handle: queue is empty!");
+        }
+        return heap_.front().id;
+    }
+
+    bool contains(handle h) const noexcept { return h < pos_.size() && pos_[h] != npos; }
+
+    const_reference value(handle h) const {
+        check(h, "indexed_priority_queue::value");
+        return heap_[pos_[h]].value;
+    }
+
+    handle push(const T& value) { return emplace(value); }
+    handle push(T&& value) { return emplace(std::move(value)); }
+
+    template <typename... Args>
+    handle emplace(Args&&... args) {
+        handle h;
+        if(!free_.empty()){
+            h = free_.back();
+            free_.pop_back();
+        }else{
+            h = pos_.size();
+            pos_.push_back(npos);
+        }
+        try
+        {
+            heap_.emplace_back(Entry{T(std::forward<Args>(args)...), h});
+        }
+        catch(...)
+        {
+            free_.push_back(h);
+            throw;
+        }
+        pos_[h] = heap_.size() - 1;
+        sift_up(heap_.size() - 1);
+        return h;
+    }
+
+    void pop() {
+        if(heap_.empty()){
+            throw std::out_of_range("indexed_priority_queue::pop: queue is empty!");
+        }
+        remove_at(0);
+    }
+
+    T take_top() {
+        if(heap_.empty()){
+            throw std::out_of_range("indexed_priority_queue::take_top: queue is empty!");
+        }
+        T value = std::move(heap_.front().value);
+        remove_at(0);
+        return value;
+    }
+
+    void erase(handle h) {
+        check(h, "indexed_priority_queue::erase");
+        remove_at(pos_[h]);
+    }
+
+    // 修改优先级：新值可能上浮也可能下沉，两个方向都试一次（只有一个会真正移动）
+    void update(handle h, T value) {
+        check(h, "indexed_priority_queue::update");
+        size_type i = pos_[h];
+        heap_[i].value = std::move(value);
+        i = sift_up(i);
+        sift_down(i);
+    }
+
+    void swap(indexed_priority_queue& other) noexcept {
+        heap_.swap(other.heap_);
+        pos_.swap(other.pos_);
+        free_.swap(other.free_);
+        std::swap(comp_, other.comp_);
+    }
+
+private:
+    struct Entry
+    {
+        T value;
+        handle id;
+    };
+
+    simple_stl::vector<Entry> heap_;
+    simple_stl::vector<size_type> pos_;
+    simple_stl::vector<handle> free_;
+    Compare comp_;
+
+    void check(handle h, const char* what) const {
+        if(!contains(h)){
+            throw std::out_of_range(what);
+        }
+    }
+
+    // 用最后一个元素填补位置 i，再按它与原位置的大小关系上浮或下沉
+    void remove_at(size_type i) {
+        handle h = heap_[i].id;
+        size_type last = heap_.size() - 1;
+        if(i != last){
+            heap_[i] = std::move(heap_[last]);
+            pos_[heap_[i].id] = i;
+        }
+        heap_.pop_back();
+        pos_[h] = npos;
+        free_.push_back(h);
+        if(i < heap_.size()){
+            i = sift_up(i);
+            sift_down(i);
+        }
+    }
+
+    size_type sift_up(size_type i) {
+        Entry entry = std::move(heap_[i]);
+        while(i > 0){
+            size_type parent = (i - 1) / D;
+            if(!comp_(heap_[parent].value, entry.value)) break;
+            heap_[i] = std::move(heap_[parent]);
+            pos_[heap_[i].id] = i;
+            i = parent;
+        }
+        pos_[entry.id] = i;
+        heap_[i] = std::move(entry);
+        return i;
+    }
+
+    void sift_down(size_type i) {
+        size_type n = heap_.size();
+        Entry entry = std::move(heap_[i]);
+        while(true){
+            size_type first = D * i + 1;
+            if(first >= n) break;
+            size_type last = first + D < n ? first + D : n;
+            size_type best = first;
+            for(size_type c = first + 1; c < last; ++c){
+                if(comp_(heap_[best].value, heap_[c].value)) best = c;
+            }
+            if(!comp_(entry.value, heap_[best].value)) break;
+            heap_[i] = std::move(heap_[best]);
+            pos_[heap_[i].id] = i;
+            i = best;
+        }
+        pos_[entry.id] = i;
+        heap_[i] = std::move(entry);
+    }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_PRIORITY_QUEUE_H
+
+/**
+ * @note 为什么不用指针作为句柄：堆中的元素会不断移动，指针随时失效；句柄是 pos_ 的下标，移动元素时同步维护 pos_
+ * @note Timer 使用 indexed_priority_queue 管理超时任务：到期任务从堆顶取出，DelTimeout 通过任务记录的句柄删除
+ */
@@ -0,0 +1,314 @@
+/**
+ * @brief 定长环形缓冲区：容量向上取整到2的幂，下标用 & mask 取模代替除法
+ *   head_ 与 tail_ 是单调递增的计数器（只在访问槽位时才取模），size = tail_ - head_，
+ *   这样“满”和“空”不需要额外的标志位或者空出一个槽来区分
+ * 溢出策略：
+ *   reject    —— 满时拒绝写入，push 返回 false（作为有界队列的存储）
+ *   overwrite —— 满时覆盖最旧的元素（作为遥测数据的滑动窗口，始终保留最近 capacity 个样本）
+ * 批量读写 push(ptr, n) / pop(ptr, n)：环形区间最多被分成两段连续内存，按段处理而不是逐个取模
+ * @note 整个生命周期只在构造时分配一次内存，之后的读写都不会再调用分配器
+ */
+#ifndef SIMPLE_STL_CONTAINERS_RING_BUFFER_H
+#define SIMPLE_STL_CONTAINERS_RING_BUFFER_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "common/allocator.h"
+#include "common/iterator.h"
+
+namespace simple_stl {
+
+enum class overflow_policy
+{
+    reject,
+    overwrite
+};
+
+template <typename T, typename Allocator = simple_stl::allocator<T>>
+class ring_buffer
+{
+private:
+    // 迭代器只记录缓冲区和逻辑位置（0 为最旧的元素），解引用时再换算到槽位
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = simple_stl::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+        using buffer_pointer = typename std::conditional<Const, const ring_buffer*, ring_buffer*>::type;
+
+        Iterator() noexcept : buffer_(nullptr), pos_(0) {}
+        Iterator(buffer_pointer buffer, std::size_t pos) noexcept : buffer_(buffer), pos_(pos) {}
+        template <bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false>& other) noexcept : buffer_(other.buffer_), pos_(other.pos_) {}
+
+        reference operator*() const noexcept { return (*buffer_)[pos_]; }
+        pointer operator->() const noexcept { return &(*buffer_)[pos_]; }
+        reference operator[](difference_type n) const noexcept { return (*buffer_)[pos_ + n]; }
+
+        Iterator& operator++() noexcept { ++pos_; return *this; }
+        Iterator operator++(int) noexcept { Iterator temp = *this; ++pos_; return temp; }
+        Iterator& operator--() noexcept { --pos_; return *this; }
+        Iterator operator--(int) noexcept { Iterator temp = *this; --pos_; return temp; }
+        Iterator& operator+=(difference_type n) noexcept { pos_ += n; return *this; }
+        Iterator& operator-=(difference_type n) noexcept { pos_ -= n; return *this; }
+        friend Iterator operator+(Iterator it, difference_type n) noexcept { return it += n; }
+        friend Iterator operator+(difference_type n, Iterator it) noexcept { return it += n; }
+        friend Iterator operator-(Iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b) noexcept {
+            return static_cast<difference_type>(a.pos_) - static_cast<difference_type>(b.pos_);
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.pos_ == b.pos_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return a.pos_ != b.pos_; }
+        friend bool operator<(const Iterator& a, const Iterator& b) noexcept { return a.pos_ < b.pos_; }
+        friend bool operator>(const Iterator& a, const Iterator& b) noexcept { return b.pos_ < a.pos_; }
+        friend bool operator<=(const Iterator& a, const Iterator& b) noexcept { return !(b.pos_ < a.pos_); }
+        friend bool operator>=(const Iterator& a, const Iterator& b) noexcept { return !(a.pos_ < b.pos_); }
+
+    private:
+        template <bool> friend class Iterator;
+        buffer_pointer buffer_;
+        std::size_t pos_;
+    };
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = simple_stl::reverse_iterator<iterator>;
+    using const_reverse_iterator = simple_stl::reverse_iterator<const_iterator>;
+
+    explicit ring_buffer(size_type capacity, overflow_policy policy = overflow_policy::reject, const Allocator& alloc = Allocator())
+        : capacity_(round_up_pow2(capacity)), mask_(capacity_ - 1), head_(0), tail_(0), policy_(policy), alloc_(alloc) {
+        if(capacity == 0){
+            throw std::invalid_argument("ring_buffer: capacity must be greater than 0");
+        }
+        data_ = alloc_.allocate(capacity_);
+    }
+
+    ring_buffer(const ring_buffer& other)
+        : capacity_(other.capacity_), mask_(other.mask_), head_(0), tail_(0), policy_(other.policy_), alloc_(other.alloc_) {
+        data_ = alloc_.allocate(capacity_);
+        try
+        {
+            for(const T& value : other) emplace_back(value);
+        }
+        catch(...)
+        {
+            clear();
+            alloc_.deallocate(data_, capacity_);
+            throw;
+        }
+    }
+
+    // 被移动的对象容量变为0，只能析构或被重新赋值
+    ring_buffer(ring_buffer&& other) noexcept
+        : data_(other.data_), capacity_(other.capacity_), mask_(other.mask_), head_(other.head_), tail_(other.tail_),
+          policy_(other.policy_), alloc_(std::move(other.alloc_)) {
+        other.data_ = nullptr;
+        other.capacity_ = 0;
+        other.mask_ = 0;
+        other.head_ = other.tail_ = 0;
+    }
+
+    ring_buffer& operator=(const ring_buffer& other) {
+        if(this != &other){
+            ring_buffer temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    ring_buffer& operator=(ring_buffer&& other) noexcept {
+        if(this != &other){
+            ring_buffer temp(std::move(other));
+            swap(temp);
+        }
+        return *this;
+    }
+
+    ~ring_buffer() {
+        clear();
+        if(data_) alloc_.deallocate(data_, capacity_);
+    }
+
+    /*    ********************** 容量 **********************     */
+    size_type size() const noexcept { return tail_ - head_; }
+    size_type capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return tail_ == head_; }
+    bool full() const noexcept { return size() == capacity_; }
+    overflow_policy policy() const noexcept { return policy_; }
+
+    /*    ********************** 访问（下标 0 为最旧的元素） **********************     */
+    reference operator[](size_type n) noexcept { return data_[(head_ + n) & mask_]; }
+    const_reference operator[](size_type n) const noexcept { return data_[(head_ + n) & mask_]; }
+
+    reference at(size_type n) {
+        if(n >= size()){
+            throw std::out_of_range("ring_buffer::at: index out of range");
+        }
+        return (*this)[n];
+    }
+    const_reference at(size_type n) const { return const_cast<ring_buffer*>(this)->at(n); }
+
+    reference front() noexcept { return data_[head_ & mask_]; }
+    const_reference front() const noexcept { return data_[head_ & mask_]; }
+    reference back() noexcept { return data_[(tail_ - 1) & mask_]; }
+    const_reference back() const noexcept { return data_[(tail_ - 1) & mask_]; }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    /*    ********************** 单个元素读写 **********************     */
+    bool push_back(const T& value) { return emplace_back(value); }
+    bool push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    // 满时：reject 模式返回 false；overwrite 模式先析构最旧的元素，腾出的槽位正好就是新元素的位置
+    template <typename... Args>
+    bool emplace_back(Args&&... args) {
+        if(full()){
+            if(policy_ == overflow_policy::reject) return false;
+            pop_front();
+        }
+        alloc_.construct(data_ + (tail_ & mask_), std::forward<Args>(args)...);
+        ++tail_;
+        return true;
+    }
+
+    void pop_front() {
+        if(empty()){
+            throw std::out_of_range("ring_buffer::pop_front: buffer is empty!");
+        }
+        alloc_.destroy(data_ + (head_ & mask_));
+        ++head_;
+    }
+
+    // 取出最旧的元素，为空时返回 false
+    bool try_pop(T& out) {
+        if(empty()) return false;
+        out = std::move(front());
+        pop_front();
+        return true;
+    }
+
+    /*    ********************** 批量读写 **********************     */
+    /**
+     * @brief 写入 [src, src + n)，返回实际写入的个数
+     * reject 模式最多写满剩余空间；overwrite 模式全部写入，超出的部分挤掉最旧的元素
+     * （n 大于容量时只有最后 capacity 个元素会保留下来，前面的直接跳过，不做无用的构造）
+     */
+    size_type push(const T* src, size_type n) {
+        size_type written = n;
+        if(policy_ == overflow_policy::reject){
+            if(n > capacity_ - size()) n = capacity_ - size();
+            written = n;
+        }else{
+            if(n > capacity_){
+                src += n - capacity_;
+                n = capacity_;
+            }
+            size_type room = capacity_ - size();
+            if(n > room) drop_front(n - room);
+        }
+        // 写入区间在物理上最多分成两段：[tail, 数组末尾) 和 [0, 剩余)
+        size_type pos = tail_ & mask_;
+        size_type first = n < capacity_ - pos ? n : capacity_ - pos;
+        construct_range(data_ + pos, src, first);
+        construct_range(data_, src + first, n - first);
+        return written;
+    }
+
+    // 取出最多 n 个最旧的元素移动到 dst，返回实际取出的个数
+    size_type pop(T* dst, size_type n) {
+        if(n > size()) n = size();
+        size_type pos = head_ & mask_;
+        size_type first = n < capacity_ - pos ? n : capacity_ - pos;
+        move_out(dst, data_ + pos, first);
+        move_out(dst + first, data_, n - first);
+        return n;
+    }
+
+    void clear() noexcept { drop_front(size()); }
+
+    void swap(ring_buffer& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(mask_, other.mask_);
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(policy_, other.policy_);
+        std::swap(alloc_, other.alloc_);
+    }
+
+private:
+    T* data_;
+    size_type capacity_;
+    size_type mask_;
+    size_type head_;   // 最旧元素的计数器
+    size_type tail_;   // 下一个写入位置的计数器
+    overflow_policy policy_;
+    Allocator alloc_;
+
+    static size_type round_up_pow2(size_type n) noexcept {
+        size_type cap = 1;
+        while(cap < n) cap <<= 1;
+        return cap;
+    }
+
+    // 逐个构造，中途抛异常时 tail_ 只推进到已构造的位置，缓冲区保持一致
+    void construct_range(T* dst, const T* src, size_type n) {
+        for(size_type i = 0; i < n; ++i){
+            alloc_.construct(dst + i, src[i]);
+            ++tail_;
+        }
+    }
+
+    void move_out(T* dst, T* src, size_type n) {
+        for(size_type i = 0; i < n; ++i){
+            dst[i] = std::move(src[i]);
+            alloc_.destroy(src + i);
+            ++head_;
+        }
+    }
+
+    void drop_front(size_type n) noexcept {
+        if(!std::is_trivially_destructible<T>::value){
+            for(size_type i = 0; i < n; ++i) alloc_.destroy(data_ + ((head_ + i) & mask_));
+        }
+        head_ += n;
+    }
+};
+
+template <typename T, typename Allocator>
+void swap(ring_buffer<T, Allocator>& a, ring_buffer<T, Allocator>& b) noexcept {
+    a.swap(b);
+}
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_RING_BUFFER_H
+
+/**
+ * @note 为什么容量取2的幂：pos & (cap - 1) 等价于 pos % cap，但只需一条与指令；
+ * 计数器溢出回绕时（size_t 的 2^64）差值 tail_ - head_ 仍然正确，因为 2^64 是 cap 的倍数
+ * @note 单线程容器，不做任何同步；多线程场景在外部加锁（例如阻塞队列中由互斥量保护）
+ */
@@ -0,0 +1,194 @@
+/**
+ * @brief 槽位表（slot map）：插入返回一个64位整数句柄，之后通过句柄 O(1) 访问、删除元素
+ *   句柄 = (generation << 32) | slot 下标；槽位被释放时 generation 加一，旧句柄随之失效，不会访问到后来复用该槽位的元素
+ *
+ *   slots_  : 槽位数组，记录元素在 values_ 中的下标和当前 generation；空闲槽位串成链表，插入时优先复用
+ *   values_ : 元素紧密排列，遍历就是线性扫描连续内存
+ *   owners_ : values_ 中每个元素所属的槽位，删除时把最后一个元素搬到空位，需要据此回填它的槽位
+ *
+ * 与 shared_ptr 相比：句柄只是一个整数，拷贝、传递没有原子引用计数的开销；
+ * 代价是所有权集中在 slot_map，持有句柄的一方访问前需要通过 find()/contains() 确认元素仍然存在
+ * @note 删除会移动最后一个元素，所以元素的地址和遍历顺序都不稳定，长期持有的应该是句柄而不是指针
+ */
+#ifndef SIMPLE_STL_CONTAINERS_SLOT_MAP_H
+#define SIMPLE_STL_CONTAINERS_SLOT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "containers/vector.h"
+
+namespace simple_stl {
+
+template <typename T>
+class slot_map
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using handle = std::uint64_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // generation 从1开始，0永远不是有效句柄，可以用作“空句柄”
+    static constexpr handle null_handle = 0;
+
+    static constexpr std::uint32_t slot_of(handle h) noexcept { return static_cast<std::uint32_t>(h); }
+    static constexpr std::uint32_t generation_of(handle h) noexcept { return static_cast<std::uint32_t>(h >> 32); }
+
+    slot_map() : free_head_(npos) {}
+
+    size_type size() const noexcept { return values_.size(); }
+    bool empty() const noexcept { return values_.empty(); }
+    void reserve(size_type n) {
+        values_.reserve(n);
+        owners_.reserve(n);
+        slots_.reserve(n);
+    }
+
+    /*    ********************** 插入删除 **********************     */
+    handle insert(const T& value) { return emplace(value); }
+    handle insert(T&& value) { return emplace(std::move(value)); }
+
+    template <typename... Args>
+    handle emplace(Args&&... args) {
+        bool fresh = free_head_ == npos;
+        std::uint32_t slot = free_head_;
+        if(fresh){
+            if(slots_.size() >= npos){
+                throw std::length_error("slot_map::emplace: too many slots");
+            }
+            slot = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(Slot{npos, 1, npos});
+        }
+        size_type old_size = values_.size();
+        try
+        {
+            values_.emplace_back(std::forward<Args>(args)...);
+            owners_.push_back(slot);
+        }
+        catch(...)
+        {
+            // 失败时元素数组恢复原状；新建的槽位挂到空闲链表上，复用的槽位本来就还在链表头
+            if(values_.size() > old_size) values_.pop_back();
+            if(fresh) release_new_slot(slot);
+            throw;
+        }
+        if(!fresh) free_head_ = slots_[slot].next_free;
+        slots_[slot].index = static_cast<std::uint32_t>(old_size);
+        return make_handle(slot, slots_[slot].generation);
+    }
+
+    // 删除句柄指向的元素，句柄已失效时返回 false
+    bool erase(handle h) {
+        if(!contains(h)) return false;
+        std::uint32_t slot = slot_of(h);
+        std::uint32_t pos = slots_[slot].index;
+        std::uint32_t last = static_cast<std::uint32_t>(values_.size() - 1);
+        // 用最后一个元素填补空位，保持 values_ 紧密
+        if(pos != last){
+            values_[pos] = std::move(values_[last]);
+            owners_[pos] = owners_[last];
+            slots_[owners_[pos]].index = pos;
+        }
+        values_.pop_back();
+        owners_.pop_back();
+        free_slot(slot);
+        return true;
+    }
+
+    // 删除所有元素，所有已发出的句柄都失效
+    void clear() noexcept {
+        for(size_type i = 0; i < owners_.size(); ++i) free_slot(owners_[i]);
+        values_.clear();
+        owners_.clear();
+    }
+
+    /*    ********************** 查找 **********************     */
+    bool contains(handle h) const noexcept {
+        std::uint32_t slot = slot_of(h);
+        return slot < slots_.size() && slots_[slot].generation == generation_of(h) && slots_[slot].index != npos;
+    }
+
+    // 句柄有效时返回元素指针，否则返回 nullptr
+    T* find(handle h) noexcept { return contains(h) ? &values_[slots_[slot_of(h)].index] : nullptr; }
+    const T* find(handle h) const noexcept { return contains(h) ? &values_[slots_[slot_of(h)].index] : nullptr; }
+
+    T& at(handle h) {
+        T* p = find(h);
+        if(!p){
+            throw std::out_of_range("slot_map::at: stale or invalid handle");
+        }
+        return *p;
+    }
+    const T& at(handle h) const { return const_cast<slot_map*>(this)->at(h); }
+
+    // 不检查句柄，调用方保证有效
+    T& operator[](handle h) noexcept { return values_[slots_[slot_of(h)].index]; }
+    const T& operator[](handle h) const noexcept { return values_[slots_[slot_of(h)].index]; }
+
+    /*    ********************** 紧密遍历 **********************     */
+    iterator begin() noexcept { return values_.begin(); }
+    iterator end() noexcept { return values_.end(); }
+    const_iterator begin() const noexcept { return values_.begin(); }
+    const_iterator end() const noexcept { return values_.end(); }
+    T* data() noexcept { return values_.data(); }
+    const T* data() const noexcept { return values_.data(); }
+
+    // 遍历时由紧密下标取回句柄
+    handle handle_at(size_type pos) const noexcept {
+        std::uint32_t slot = owners_[pos];
+        return make_handle(slot, slots_[slot].generation);
+    }
+
+    void swap(slot_map& other) noexcept {
+        values_.swap(other.values_);
+        owners_.swap(other.owners_);
+        slots_.swap(other.slots_);
+        std::swap(free_head_, other.free_head_);
+    }
+
+private:
+    static constexpr std::uint32_t npos = static_cast<std::uint32_t>(-1);
+
+    struct Slot
+    {
+        std::uint32_t index;      // 元素在 values_ 中的下标，空闲时为 npos
+        std::uint32_t generation;
+        std::uint32_t next_free;  // 空闲链表中的下一个槽位
+    };
+
+    simple_stl::vector<T> values_;
+    simple_stl::vector<std::uint32_t> owners_;
+    simple_stl::vector<Slot> slots_;
+    std::uint32_t free_head_;
+
+    static constexpr handle make_handle(std::uint32_t slot, std::uint32_t generation) noexcept {
+        return (static_cast<handle>(generation) << 32) | slot;
+    }
+
+    // generation 回绕时跳过0，保证 null_handle 永远无效
+    void free_slot(std::uint32_t slot) noexcept {
+        Slot& s = slots_[slot];
+        s.index = npos;
+        if(++s.generation == 0) s.generation = 1;
+        s.next_free = free_head_;
+        free_head_ = slot;
+    }
+
+    // 新建的槽位在插入失败时直接挂到空闲链表上
+    void release_new_slot(std::uint32_t slot) noexcept {
+        slots_[slot].next_free = free_head_;
+        free_head_ = slot;
+    }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_SLOT_MAP_H
+
+/**
+ * @note 为什么不直接用 vector 下标作为句柄：删除会搬动元素，下标会指向别的元素；
+ * 多一层槽位间接寻址，加上 generation 校验，句柄才能在元素被删除、槽位被复用后可靠地失效
+ */
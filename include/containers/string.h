@@ -12,6 +12,7 @@
 #include <cstddef> // size_t
 #include <algorithm>
 #include <cstring>
+#include <stdexcept> // std::invalid_argument
 
 namespace simple_stl {
 
@@ -0,0 +1,250 @@
+/**
+ * @brief 字符串惰性切分：按单字符、字符集合、子串三种分隔符切分，迭代时返回指向原缓冲区的 std::string_view，
+ * 整个过程不申请任何内存（适用于 CSV、日志等逐字段解析的场景）
+ * split():    保留空字段，"a,,b" -> "a" "" "b"
+ * tokenize(): 跳过空字段，"a,,b" -> "a" "b"
+ * @note 返回的视图依赖原字符串的生命周期，因此禁止对临时 simple_stl::string 调用（右值重载被 delete）
+ */
+#ifndef SIMPLE_STL_CONTAINERS_STRING_SPLIT_H
+#define SIMPLE_STL_CONTAINERS_STRING_SPLIT_H
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "common/iterator.h"
+#include "containers/string.h"
+
+namespace simple_stl {
+
+/*    ********************** 分隔符策略 **********************     */
+// 统一接口：find(text, pos) 返回 {分隔符起始位置, 分隔符长度}，找不到时起始位置为 npos
+
+// 单字符分隔符：直接交给 memchr，glibc 中的 memchr 本身就是按 SIMD 宽度扫描的
+struct char_delimiter {
+    char ch;
+
+    explicit char_delimiter(char c) noexcept : ch(c) {}
+
+    std::pair<std::size_t, std::size_t> find(std::string_view text, std::size_t pos) const noexcept {
+        const void* hit = std::memchr(text.data() + pos, ch, text.size() - pos);
+        if(!hit) return {std::string_view::npos, 0};
+        return {static_cast<std::size_t>(static_cast<const char*>(hit) - text.data()), 1};
+    }
+};
+
+// 字符集合分隔符：集合较小时用 SSE2 一次比较 16 字节，其余情况（以及尾部不足 16 字节）查 256 项的表
+struct any_of_delimiter {
+    static const std::size_t simd_max_chars = 8; // 超过该数量时逐字符比较的开销反而高于查表
+
+    bool table[256];
+    char chars[simd_max_chars];
+    std::size_t nchars;
+
+    explicit any_of_delimiter(std::string_view set) : table(), chars(), nchars(set.size()) {
+        if(set.empty()){
+            throw std::invalid_argument("any_of_delimiter: empty delimiter set");
+        }
+        for(char c : set){
+            table[static_cast<unsigned char>(c)] = true;
+        }
+        if(nchars <= simd_max_chars){
+            std::memcpy(chars, set.data(), nchars);
+        }
+    }
+
+    std::pair<std::size_t, std::size_t> find(std::string_view text, std::size_t pos) const noexcept {
+        const char* p = text.data();
+        std::size_t n = text.size();
+#if defined(__SSE2__)
+        if(nchars <= simd_max_chars){
+            for(; pos + 16 <= n; pos += 16){
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + pos));
+                __m128i hit = _mm_setzero_si128();
+                for(std::size_t i = 0; i < nchars; ++i){
+                    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(block, _mm_set1_epi8(chars[i])));
+                }
+                int mask = _mm_movemask_epi8(hit);
+                if(mask != 0){
+                    return {pos + static_cast<std::size_t>(__builtin_ctz(mask)), 1};
+                }
+            }
+        }
+#endif
+        for(; pos < n; ++pos){
+            if(table[static_cast<unsigned char>(p[pos])]) return {pos, 1};
+        }
+        return {std::string_view::npos, 0};
+    }
+};
+
+// 子串分隔符：memchr 定位首字符后再 memcmp 校验整个子串
+struct substr_delimiter {
+    std::string_view sep;
+
+    explicit substr_delimiter(std::string_view s) : sep(s) {
+        if(sep.empty()){
+            throw std::invalid_argument("substr_delimiter: empty separator");
+        }
+    }
+
+    std::pair<std::size_t, std::size_t> find(std::string_view text, std::size_t pos) const noexcept {
+        const char* p = text.data();
+        std::size_t n = text.size();
+        while(pos + sep.size() <= n){
+            const void* hit = std::memchr(p + pos, sep[0], n - pos - sep.size() + 1);
+            if(!hit) break;
+            pos = static_cast<std::size_t>(static_cast<const char*>(hit) - p);
+            if(std::memcmp(p + pos, sep.data(), sep.size()) == 0){
+                return {pos, sep.size()};
+            }
+            ++pos;
+        }
+        return {std::string_view::npos, 0};
+    }
+};
+
+/*    ********************** 切分区间 **********************     */
+
+template <typename Delimiter, bool SkipEmpty>
+class split_range
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = simple_stl::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::string_view;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+        iterator() noexcept : range_(nullptr), pos_(0), at_end_(true) {}
+
+        reference operator*() const noexcept { return field_; }
+        pointer operator->() const noexcept { return &field_; }
+
+        iterator& operator++() {
+            advance();
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator temp = *this;
+            advance();
+            return temp;
+        }
+
+        // 两个end迭代器相等；未结束时以下一次扫描的起点区分位置
+        bool operator==(const iterator& other) const noexcept {
+            if(at_end_ || other.at_end_) return at_end_ == other.at_end_;
+            return pos_ == other.pos_;
+        }
+        bool operator!=(const iterator& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        friend class split_range;
+
+        explicit iterator(const split_range* range) : range_(range), pos_(0), at_end_(false) {
+            advance();
+        }
+
+        // pos_ 是下一个字段的起点，pos_ > size 表示最后一个字段已经产出
+        void advance() {
+            std::string_view text = range_->text_;
+            for(;;){
+                if(pos_ > text.size()){
+                    at_end_ = true;
+                    return;
+                }
+                std::pair<std::size_t, std::size_t> hit = range_->delim_.find(text, pos_);
+                if(hit.first == std::string_view::npos){
+                    field_ = text.substr(pos_);
+                    pos_ = text.size() + 1;
+                }else{
+                    field_ = text.substr(pos_, hit.first - pos_);
+                    pos_ = hit.first + hit.second;
+                }
+                if(!SkipEmpty || !field_.empty()) return;
+            }
+        }
+
+        const split_range* range_;
+        std::string_view field_;
+        std::size_t pos_;
+        bool at_end_;
+    };
+
+    using const_iterator = iterator;
+
+    split_range(std::string_view text, const Delimiter& delim) : text_(text), delim_(delim) {}
+
+    // 迭代器持有指向区间的指针，区间对象需要在遍历期间存活（范围for天然满足）
+    iterator begin() const { return iterator(this); }
+    iterator end() const noexcept { return iterator(); }
+
+private:
+    std::string_view text_;
+    Delimiter delim_;
+};
+
+/*    ********************** 便捷接口 **********************     */
+
+inline std::string_view to_string_view(const simple_stl::string& s) noexcept {
+    return std::string_view(s.data(), s.size());
+}
+inline std::string_view to_string_view(std::string_view s) noexcept { return s; }
+inline std::string_view to_string_view(const char* s) noexcept { return std::string_view(s); }
+
+template <typename Str>
+split_range<char_delimiter, false> split(const Str& s, char delim) {
+    return {to_string_view(s), char_delimiter(delim)};
+}
+template <typename Str>
+split_range<substr_delimiter, false> split(const Str& s, std::string_view sep) {
+    return {to_string_view(s), substr_delimiter(sep)};
+}
+template <typename Str>
+split_range<any_of_delimiter, false> split_any_of(const Str& s, std::string_view set) {
+    return {to_string_view(s), any_of_delimiter(set)};
+}
+
+template <typename Str>
+split_range<char_delimiter, true> tokenize(const Str& s, char delim) {
+    return {to_string_view(s), char_delimiter(delim)};
+}
+template <typename Str>
+split_range<substr_delimiter, true> tokenize(const Str& s, std::string_view sep) {
+    return {to_string_view(s), substr_delimiter(sep)};
+}
+template <typename Str>
+split_range<any_of_delimiter, true> tokenize_any_of(const Str& s, std::string_view set) {
+    return {to_string_view(s), any_of_delimiter(set)};
+}
+
+// 临时字符串在表达式结束后即被释放，返回的视图会悬垂，直接在编译期拒绝
+template <typename Str>
+using enable_if_temp_string_t = typename std::enable_if<
+    std::is_same<typename std::decay<Str>::type, simple_stl::string>::value && !std::is_lvalue_reference<Str>::value>::type;
+
+template <typename Str, typename Delim, typename = enable_if_temp_string_t<Str>> void split(Str&&, Delim&&) = delete;
+template <typename Str, typename Delim, typename = enable_if_temp_string_t<Str>> void split_any_of(Str&&, Delim&&) = delete;
+template <typename Str, typename Delim, typename = enable_if_temp_string_t<Str>> void tokenize(Str&&, Delim&&) = delete;
+template <typename Str, typename Delim, typename = enable_if_temp_string_t<Str>> void tokenize_any_of(Str&&, Delim&&) = delete;
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_STRING_SPLIT_H
+
+/**
+ * @note std::string_view 只保存“指针+长度”，拷贝代价等同于两个整数，字段切分时不会复制任何字符
+ * @note SSE2 路径：_mm_cmpeq_epi8 逐字节比较得到 0xFF/0x00 掩码，_mm_movemask_epi8 把16个字节的最高位压成16位整数，
+ * __builtin_ctz 取最低位的1即为第一个命中的下标
+ */
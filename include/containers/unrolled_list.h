@@ -0,0 +1,417 @@
+/**
+ * @brief 展开链表（unrolled linked list）：每个节点保存一小段连续元素，节点大小按缓存行（默认128字节，两条缓存行）计算
+ * 顺序遍历时一次缓存未命中可以读到一整段元素，中间插入/删除只需在单个节点内搬移少量元素
+ * 节点满时对半分裂，删除后节点不足半满且能与后继合并时自动合并，保证平均填充率
+ * @note 与 List 不同，插入/删除会搬移同一节点内的其他元素，因此这些元素的迭代器和引用会失效；
+ * 元素的移动构造不应抛出异常
+ */
+#ifndef SIMPLE_STL_CONTAINERS_UNROLLED_LIST_H
+#define SIMPLE_STL_CONTAINERS_UNROLLED_LIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "common/allocator.h"
+#include "common/iterator.h"
+
+namespace simple_stl {
+
+template <typename T, typename Allocator = simple_stl::allocator<T>, std::size_t NodeBytes = 128>
+class unrolled_list
+{
+private:
+    // 链接部分，哨兵只有这一部分，count恒为0
+    struct NodeBase {
+        NodeBase* prev = nullptr;
+        NodeBase* next = nullptr;
+        std::size_t count = 0;
+    };
+
+public:
+    // 每个节点可容纳的元素个数：节点总大小减去链接头后能放下多少个T（至少1个）
+    static constexpr std::size_t node_capacity =
+        NodeBytes > sizeof(NodeBase) + sizeof(T) ? (NodeBytes - sizeof(NodeBase)) / sizeof(T) : 1;
+
+private:
+    struct Node : NodeBase {
+        alignas(T) unsigned char storage[node_capacity * sizeof(T)];
+
+        T* slot(std::size_t i) noexcept { return reinterpret_cast<T*>(storage) + i; }
+    };
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = simple_stl::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        Iterator() noexcept : node_(nullptr), index_(0) {}
+        template <bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false>& other) noexcept : node_(other.node_), index_(other.index_) {}
+
+        reference operator*() const noexcept { return *static_cast<Node*>(node_)->slot(index_); }
+        pointer operator->() const noexcept { return static_cast<Node*>(node_)->slot(index_); }
+
+        // 节点内只移动下标，越过节点末尾时才跳到下一个节点
+        Iterator& operator++() noexcept {
+            if(++index_ >= node_->count){
+                node_ = node_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+        Iterator operator++(int) noexcept { Iterator temp = *this; ++*this; return temp; }
+
+        Iterator& operator--() noexcept {
+            if(index_ == 0){
+                node_ = node_->prev;
+                index_ = node_->count - 1;
+            }else{
+                --index_;
+            }
+            return *this;
+        }
+        Iterator operator--(int) noexcept { Iterator temp = *this; --*this; return temp; }
+
+        bool operator==(const Iterator& other) const noexcept {
+            return node_ == other.node_ && index_ == other.index_;
+        }
+        bool operator!=(const Iterator& other) const noexcept { return !(*this == other); }
+
+    private:
+        friend class unrolled_list;
+        template <bool> friend class Iterator;
+
+        Iterator(NodeBase* node, std::size_t index) noexcept : node_(node), index_(index) {}
+
+        NodeBase* node_;
+        std::size_t index_;
+    };
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using NodeAllocator = typename Allocator::template rebind<Node>::other;
+
+    unrolled_list(const Allocator& alloc = Allocator()) : node_alloc_(alloc) { initDummy(); }
+
+    unrolled_list(std::initializer_list<T> il, const Allocator& alloc = Allocator()) : node_alloc_(alloc) {
+        initDummy();
+        try
+        {
+            for(const T& v : il) push_back(v);
+        }
+        catch(...)
+        {
+            clear();
+            throw;
+        }
+    }
+
+    unrolled_list(const unrolled_list& other) : node_alloc_(other.node_alloc_) {
+        initDummy();
+        try
+        {
+            for(const T& v : other) push_back(v);
+        }
+        catch(...)
+        {
+            clear();
+            throw;
+        }
+    }
+
+    unrolled_list(unrolled_list&& other) noexcept : node_alloc_(other.node_alloc_) {
+        initDummy();
+        swap(other);
+    }
+
+    unrolled_list& operator=(const unrolled_list& other) {
+        if(this != &other){
+            unrolled_list temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    unrolled_list& operator=(unrolled_list&& other) noexcept {
+        if(this != &other){
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~unrolled_list() { clear(); }
+
+    void swap(unrolled_list& other) noexcept {
+        std::swap(head_.prev, other.head_.prev);
+        std::swap(head_.next, other.head_.next);
+        std::swap(size_, other.size_);
+        std::swap(node_alloc_, other.node_alloc_);
+        fixSentinel();
+        other.fixSentinel();
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    reference front() { return *asNode(head_.next)->slot(0); }
+    const_reference front() const { return *asNode(head_.next)->slot(0); }
+    reference back() { return *asNode(head_.prev)->slot(head_.prev->count - 1); }
+    const_reference back() const { return *asNode(head_.prev)->slot(head_.prev->count - 1); }
+
+    iterator begin() noexcept { return iterator(head_.next, 0); }
+    iterator end() noexcept { return iterator(&head_, 0); }
+    const_iterator begin() const noexcept { return const_iterator(head_.next, 0); }
+    const_iterator end() const noexcept { return const_iterator(const_cast<NodeBase*>(&head_), 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    void push_back(const T& val) { emplace_back(val); }
+    void push_back(T&& val) { emplace_back(std::move(val)); }
+    void push_front(const T& val) { emplace_front(val); }
+    void push_front(T&& val) { emplace_front(std::move(val)); }
+
+    // 尾部追加：顺序写入时把节点填满再开新节点，不做对半分裂
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        NodeBase* last = head_.prev;
+        if(last == &head_ || last->count == node_capacity){
+            last = insertNodeBefore(&head_);
+        }
+        Node* node = asNode(last);
+        try
+        {
+            constructAt(node, node->count, std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            if(node->count == 0) freeNode(node);
+            throw;
+        }
+        ++node->count;
+        ++size_;
+        return *node->slot(node->count - 1);
+    }
+
+    template <typename... Args>
+    reference emplace_front(Args&&... args) {
+        NodeBase* first = head_.next;
+        if(first == &head_ || first->count == node_capacity){
+            first = insertNodeBefore(head_.next);
+        }
+        return *emplaceInNode(asNode(first), 0, std::forward<Args>(args)...);
+    }
+
+    // 在pos之前构造元素，返回指向新元素的迭代器
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if(pos.node_ == &head_){
+            emplace_back(std::forward<Args>(args)...);
+            return iterator(head_.prev, head_.prev->count - 1);
+        }
+        Node* node = asNode(pos.node_);
+        size_type index = pos.index_;
+        if(node->count == node_capacity){
+            NodeBase* prev = node->prev;
+            if(index == 0 && prev != &head_ && prev->count < node_capacity){
+                // 插在节点开头且前驱还有空位：直接追加到前驱末尾，不需要分裂
+                Node* p = asNode(prev);
+                emplaceInNode(p, p->count, std::forward<Args>(args)...);
+                return iterator(p, p->count - 1);
+            }
+            // 对半分裂：后半部分搬到新节点
+            Node* right = asNode(insertNodeBefore(node->next));
+            size_type half = node_capacity / 2;
+            relocate(node, half, node_capacity, right, 0);
+            right->count = node_capacity - half;
+            node->count = half;
+            if(index > half){
+                node = right;
+                index -= half;
+            }
+        }
+        emplaceInNode(node, index, std::forward<Args>(args)...);
+        return iterator(node, index);
+    }
+
+    iterator insert(const_iterator pos, const T& val) { return emplace(pos, val); }
+    iterator insert(const_iterator pos, T&& val) { return emplace(pos, std::move(val)); }
+
+    // 删除pos处元素，返回下一个元素的位置
+    iterator erase(const_iterator pos) {
+        Node* node = asNode(pos.node_);
+        size_type index = pos.index_;
+        node_alloc_.destroy(node->slot(index));
+        relocate(node, index + 1, node->count, node, index);
+        --node->count;
+        --size_;
+
+        if(node->count == 0){
+            NodeBase* next = node->next;
+            freeNode(node);
+            return iterator(next, 0);
+        }
+        // 不足半满且能装下后继的全部元素时，把后继并入当前节点
+        NodeBase* next = node->next;
+        if(node->count < node_capacity / 2 && next != &head_ && node->count + next->count <= node_capacity){
+            Node* right = asNode(next);
+            relocate(right, 0, right->count, node, node->count);
+            node->count += right->count;
+            right->count = 0;
+            freeNode(right);
+        }
+        if(index < node->count) return iterator(node, index);
+        return iterator(node->next, 0);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        // 逐个删除：合并会改变后续元素的位置，因此用剩余个数控制循环
+        size_type n = 0;
+        for(const_iterator it = first; it != last; ++it) ++n;
+        iterator it(first.node_, first.index_);
+        while(n--) it = erase(it);
+        return it;
+    }
+
+    void pop_back() {
+        if(empty()){
+            throw std::out_of_range("unrolled_list::pop_back: container is empty!");
+        }
+        erase(iterator(head_.prev, head_.prev->count - 1));
+    }
+
+    void pop_front() {
+        if(empty()){
+            throw std::out_of_range("unrolled_list::pop_front: container is empty!");
+        }
+        erase(begin());
+    }
+
+    void clear() noexcept {
+        NodeBase* curr = head_.next;
+        while(curr != &head_){
+            NodeBase* next = curr->next;
+            Node* node = asNode(curr);
+            for(size_type i = 0; i < node->count; ++i){
+                node_alloc_.destroy(node->slot(i));
+            }
+            node_alloc_.destroy(node);
+            node_alloc_.deallocate(node, 1);
+            curr = next;
+        }
+        initDummy();
+    }
+
+    // 当前节点数，可用于观察填充率
+    size_type node_count() const noexcept {
+        size_type n = 0;
+        for(const NodeBase* p = head_.next; p != &head_; p = p->next) ++n;
+        return n;
+    }
+
+private:
+    NodeBase head_;
+    size_type size_;
+    NodeAllocator node_alloc_;
+
+    static Node* asNode(NodeBase* p) noexcept { return static_cast<Node*>(p); }
+    static const Node* asNode(const NodeBase* p) noexcept { return static_cast<const Node*>(p); }
+
+    void initDummy() noexcept {
+        head_.prev = &head_;
+        head_.next = &head_;
+        head_.count = 0;
+        size_ = 0;
+    }
+
+    void fixSentinel() noexcept {
+        if(size_ == 0){
+            initDummy();
+        }else{
+            head_.next->prev = &head_;
+            head_.prev->next = &head_;
+        }
+    }
+
+    template <typename... Args>
+    void constructAt(Node* node, size_type index, Args&&... args) {
+        node_alloc_.construct(node->slot(index), std::forward<Args>(args)...);
+    }
+
+    // 把node中[first, last)搬到dst从dst_index开始的位置，源区间的对象被销毁；支持同节点内前后重叠搬移
+    void relocate(Node* node, size_type first, size_type last, Node* dst, size_type dst_index) noexcept {
+        if(node == dst && dst_index > first){
+            for(size_type i = last; i > first; --i){
+                node_alloc_.construct(dst->slot(dst_index + (i - 1 - first)), std::move(*node->slot(i - 1)));
+                node_alloc_.destroy(node->slot(i - 1));
+            }
+        }else{
+            for(size_type i = first; i < last; ++i){
+                node_alloc_.construct(dst->slot(dst_index + (i - first)), std::move(*node->slot(i)));
+                node_alloc_.destroy(node->slot(i));
+            }
+        }
+    }
+
+    // 在未满节点的index处构造元素，后面的元素整体后移一格
+    template <typename... Args>
+    T* emplaceInNode(Node* node, size_type index, Args&&... args) {
+        relocate(node, index, node->count, node, index + 1);
+        try
+        {
+            constructAt(node, index, std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            relocate(node, index + 1, node->count + 1, node, index); // 恢复原状
+            if(node->count == 0) freeNode(node);
+            throw;
+        }
+        ++node->count;
+        ++size_;
+        return node->slot(index);
+    }
+
+    NodeBase* insertNodeBefore(NodeBase* pos) {
+        Node* node = node_alloc_.allocate(1);
+        ::new(static_cast<void*>(node)) Node(); // 只初始化链接头，元素槽保持未构造
+        NodeBase* prev = pos->prev;
+        node->prev = prev;
+        node->next = pos;
+        prev->next = node;
+        pos->prev = node;
+        return node;
+    }
+
+    // 节点内元素已经全部销毁或搬走后调用
+    void freeNode(Node* node) noexcept {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        node_alloc_.destroy(node);
+        node_alloc_.deallocate(node, 1);
+    }
+};
+
+} // namespace simple_stl
+#endif // SIMPLE_STL_CONTAINERS_UNROLLED_LIST_H
+
+/**
+ * @note 节点布局：[prev | next | count | T T T ... T]，默认128字节时 int 每个节点可放26个，
+ * 遍历 n 个元素只需访问约 n/26 个节点，而 List 需要访问 n 个节点
+ * @note 迭代器由“节点指针 + 节点内下标”组成，end() 为（哨兵, 0），哨兵的count恒为0
+ */
@@ -5,6 +5,7 @@
 #include "common/iterator.h"     // 迭代器基类（使用原始指针替代）
 #include "common/utilities.h"    // 工具函数（示例中包含move/swap等）
 
+#include <algorithm>  // std::move, std::move_backward
 #include <cstddef>    // size_t
 #include <stdexcept>  // std::length_error
 #include <type_traits> // 类型萃取
@@ -26,6 +27,8 @@ public:
     using const_reference = const T&;
     using iterator = pointer;          // 简化为原始指针迭代器
     using const_iterator = const_pointer;
+    using reverse_iterator = simple_stl::reverse_iterator<iterator>;
+    using const_reverse_iterator = simple_stl::reverse_iterator<const_iterator>;
 
 private:
     
@@ -40,9 +43,10 @@ public:
     // 构造函数: 仅初始化空容器
     vector() : alloc_(), start_(nullptr),finish_(nullptr), end_of_storage_(nullptr), capacity_(0),size_(0) {}
 
-    // 析构函数
+    // 析构函数：先析构元素，再释放内存
     ~vector() {
         if (start_) {
+            clear();
             // 释放内存（使用分配器释放）
             alloc_.deallocate(start_, capacity_);
             start_ = nullptr;
@@ -132,13 +136,29 @@ public:
     size_type max_size() const { return alloc_.max_size(); } // 简单实现，返回分配器支持的最大值
     
     const pointer start() const { return start_; }
-        iterator end(){
+
+    // 迭代器：原始指针本身就是随机访问迭代器，可直接用于 std 算法
+    iterator begin() noexcept { return iterator(start_); }
+    const_iterator begin() const noexcept { return const_iterator(start_); }
+    const_iterator cbegin() const noexcept { return const_iterator(start_); }
+
+    iterator end() noexcept {
         return iterator(this->finish_);
     }
 
-    const_iterator end() const{
+    const_iterator end() const noexcept {
         return const_iterator(this->finish_);
     }
+    const_iterator cend() const noexcept { return const_iterator(finish_); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    bool empty() const noexcept { return size_ == 0; }
 
     reference operator[](size_type n){
         return *(start_ + n);
@@ -148,6 +168,14 @@ public:
         return *(start_ + n);
     }
 
+    reference front() { return *start_; }
+    const_reference front() const { return *start_; }
+    reference back() { return *(finish_ - 1); }
+    const_reference back() const { return *(finish_ - 1); }
+
+    pointer data() noexcept { return start_; }
+    const_pointer data() const noexcept { return start_; }
+
     void reserve(size_type n) {
 
         if (n > max_size()) {
@@ -197,8 +225,14 @@ public:
     template<typename... Args> 
     reference emplace_back(Args&& ...args){
         if(size_ >= capacity_){
+            // 扩容前先构造出新值：args 可能引用容器内的元素，扩容后旧内存已被释放
+            T value(std::forward<Args>(args)...);
             size_type new_capacity = (capacity_ == 0)?1: capacity_ * 2;
             reserve(new_capacity);
+            alloc_.construct(finish_, std::move(value));
+            ++finish_;
+            ++size_;
+            return *(finish_ - 1);
         }
         alloc_.construct(finish_, std::forward<Args>(args)...);
         ++finish_;
@@ -214,6 +248,51 @@ public:
         emplace_back(std::move(value));
     }
 
+    // 在pos之前就地构造新元素，[pos, end) 整体后移一位，返回指向新元素的迭代器
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&& ...args){
+        size_type index = pos - start_; // 扩容会使pos失效，先记下下标
+        if(index == size_){
+            emplace_back(std::forward<Args>(args)...);
+            return start_ + index;
+        }
+        // 先构造出新值：args 可能引用容器内的元素，后移之后就不再指向原值了
+        T value(std::forward<Args>(args)...);
+        if(size_ >= capacity_){
+            reserve(capacity_ * 2);
+        }
+        alloc_.construct(finish_, std::move(*(finish_ - 1)));
+        ++finish_;
+        ++size_;
+        std::move_backward(start_ + index, finish_ - 2, finish_ - 1);
+        start_[index] = std::move(value);
+        return start_ + index;
+    }
+
+    iterator insert(const_iterator pos, const T& value){
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value){
+        return emplace(pos, std::move(value));
+    }
+
+    // 删除 [first, last)，后面的元素整体前移，返回指向被删除区间之后元素的迭代器
+    iterator erase(const_iterator first, const_iterator last){
+        iterator dst = start_ + (first - start_);
+        if(first == last) return dst;
+        iterator new_finish = std::move(start_ + (last - start_), finish_, dst);
+        while(finish_ != new_finish){
+            alloc_.destroy(--finish_);
+        }
+        size_ = finish_ - start_;
+        return dst;
+    }
+
+    iterator erase(const_iterator pos){
+        return erase(pos, pos + 1);
+    }
+
     void pop_back(){
         if(size_ == 0){
             throw std::out_of_range("vector::pop_back: container is empty!");
@@ -222,6 +301,32 @@ public:
         --finish_;
         --size_;
     }
+
+    // 调整元素个数为n：变小时析构尾部多余的元素，变大时在尾部构造新元素（不带value时值初始化）
+    void resize(size_type n){
+        resize_impl(n);
+    }
+
+    void resize(size_type n, const T& value){
+        T copy(value); // value 可能引用容器内的元素，扩容后会失效
+        resize_impl(n, copy);
+    }
+
+private:
+    template<typename... Args>
+    void resize_impl(size_type n, const Args& ...args){
+        while(size_ > n){
+            pop_back();
+        }
+        if(n > capacity_){
+            reserve(n > capacity_ * 2 ? n : capacity_ * 2);
+        }
+        while(size_ < n){
+            alloc_.construct(finish_, args...);
+            ++finish_;
+            ++size_;
+        }
+    }
 };
 
 } // namespace simple_stl
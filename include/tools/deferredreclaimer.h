@@ -0,0 +1,97 @@
+#ifndef DEFERREDRECLAIMER_H
+#define DEFERREDRECLAIMER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common/shared_ptr.h"
+#include "tools/threadpool.h"
+
+/**
+ * @brief 延迟回收器：把对象的析构和释放从释放最后一个引用的线程转移到线程池
+ * 调用 Retire() 的线程只把 (指针, 销毁函数) 放进当前批次；攒满 batch_size 个后整批作为一个任务 Post 到线程池，
+ * 由工作线程依次销毁，请求线程上不再出现析构大对象图带来的延迟尖峰
+ * @note 必须先于 pool 析构；析构时会 Drain()，保证所有交给它的对象都已销毁
+ */
+class DeferredReclaimer
+{
+public:
+    using Destroy = void (*)(void*);
+
+    explicit DeferredReclaimer(ThreadPool& pool, std::size_t batch_size = 64);
+    ~DeferredReclaimer();
+
+    DeferredReclaimer(const DeferredReclaimer&) = delete;
+    DeferredReclaimer& operator=(const DeferredReclaimer&) = delete;
+
+    // 登记一个待销毁对象，批次满时投递到线程池
+    void Retire(void* p, Destroy destroy);
+
+    template <typename T>
+    void Retire(T* p) {
+        Retire(static_cast<void*>(p), [](void* q){ delete static_cast<T*>(q); });
+    }
+
+    // 把当前未满的批次也投递出去
+    void Flush();
+
+    // Flush 并等待所有已投递的批次执行完毕
+    void Drain();
+
+    // 尚未投递的对象个数
+    std::size_t Pending() const;
+
+    // 由回收器析构对象的 shared_ptr：最后一个引用释放时不调用 delete，而是交给 Retire
+    template <typename T, typename... Args>
+    simple_stl::shared_ptr<T> MakeShared(Args&&... args);
+
+private:
+    struct Garbage
+    {
+        void* ptr;
+        Destroy destroy;
+    };
+
+    void PostBatch(std::vector<Garbage>&& batch);
+
+    ThreadPool& pool_;
+    std::size_t batch_size_;
+    mutable std::mutex mutex_;
+    std::condition_variable idle_;
+    std::vector<Garbage> batch_;  // 正在攒的批次
+    std::size_t in_flight_;       // 已投递、尚未执行完的批次数
+};
+
+/**
+ * @brief 配合 shared_ptr(p, deleter) 使用的删除器：把对象交给 DeferredReclaimer，而不是就地 delete
+ * 控制块本身仍在当前线程释放（很小），被管理对象的析构才是要转移的开销
+ */
+template <typename T>
+class deferred_delete
+{
+public:
+    explicit deferred_delete(DeferredReclaimer& reclaimer) : reclaimer_(&reclaimer) {}
+
+    void operator()(T* p) const {
+        if(p) reclaimer_->Retire(p);
+    }
+
+private:
+    DeferredReclaimer* reclaimer_;
+};
+
+template <typename T, typename... Args>
+simple_stl::shared_ptr<T> DeferredReclaimer::MakeShared(Args&&... args) {
+    return simple_stl::shared_ptr<T>(new T(std::forward<Args>(args)...), deferred_delete<T>(*this));
+}
+
+#endif // DEFERREDRECLAIMER_H
+
+/**
+ * @note make_shared 得到的对象与控制块在同一块内存上，只能在控制块里就地析构，无法延迟；
+ * 需要延迟回收的对象用 MakeShared() 或 shared_ptr(new T, deferred_delete<T>(reclaimer)) 创建
+ * @note 批处理的意义：每个对象单独 Post 一次会把开销转移到任务队列的锁上，整批投递后每 batch_size 个对象只进一次队列
+ */
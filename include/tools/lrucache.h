@@ -1,36 +1,36 @@
 #ifndef LRUCACHE_H
 #define LRUCACHE_H
 
-#include <memory>
-#include <unordered_map>
+#include "common/shared_ptr.h"
+#include "containers/flat_hash_map.h"
 
 class LRUCache
 {
 private:
-    // 链表节点
+    // 链表节点；LRUCache 本身不加锁，只在单线程内使用，节点用 local_shared_ptr 省去原子计数
     struct ListNode
     {
         int val;
         int key;
-        std::weak_ptr<ListNode> prev; 
-        std::shared_ptr<ListNode> next;
+        simple_stl::local_weak_ptr<ListNode> prev; 
+        simple_stl::local_shared_ptr<ListNode> next;
 
         ListNode(int v, int k):val(v), key(k),prev(),next(nullptr) {}
     };
     // 链表头尾哑节点
-    std::shared_ptr<ListNode> head_;
-    std::shared_ptr<ListNode> tail_;
-    // 哈希表
-    std::unordered_map<int, std::shared_ptr<ListNode>> cacheMap_;
+    simple_stl::local_shared_ptr<ListNode> head_;
+    simple_stl::local_shared_ptr<ListNode> tail_;
+    // 哈希表（开放寻址，一次查找通常只访问一个控制字节组和一个槽）
+    simple_stl::flat_hash_map<int, simple_stl::local_shared_ptr<ListNode>> cacheMap_;
     int capacity_; // 最近最少使用缓存的容量
 
-    void moveToHead(std::shared_ptr<ListNode> node);
-    std::shared_ptr<ListNode> removeTail();
+    void moveToHead(simple_stl::local_shared_ptr<ListNode> node);
+    simple_stl::local_shared_ptr<ListNode> removeTail();
     
 public:
     LRUCache(int cap):capacity_(cap){
-        head_ = std::make_shared<ListNode>(-1, -1);
-        tail_ = std::make_shared<ListNode>(-1, -1);
+        head_ = simple_stl::make_local_shared<ListNode>(-1, -1);
+        tail_ = simple_stl::make_local_shared<ListNode>(-1, -1);
         head_->next = tail_;
         tail_->prev = head_;
     };
@@ -4,13 +4,27 @@
 #include <vector>
 #include <thread>
 #include <functional>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
 #include "tools/blockingqueue_o2m.h"
 #include "tools/blockingqueue_m2m.h"
+#include "tools/workstealingdeque.h"
 
 class ThreadPool {
 public:
+    /**
+     * @brief 调度方式
+     * SharedQueue  —— 所有任务进入同一个 BlockingQueue_M2M，所有工作线程竞争同一把锁
+     * WorkStealing —— 每个工作线程一个 Chase-Lev 双端队列；工作线程内 Post 的任务进入自己的队列，
+     *                 外部线程 Post 的任务进入注入队列；本地队列空了先取注入队列，再随机挑选其他线程窃取
+     */
+    enum class Mode { SharedQueue, WorkStealing };
+
     // 构造线程池
-    explicit ThreadPool(int nums_threads);
+    explicit ThreadPool(int nums_threads, Mode mode = Mode::SharedQueue);
 
     ~ThreadPool();
 
@@ -25,15 +39,36 @@ public:
     void Post(F &&f, Args &&...args){
 
         auto task = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+        if(mode_ == Mode::WorkStealing){
+            Submit(std::function<void()>(std::move(task)));
+            return;
+        }
         task_queue.Push(task);
     }; // 参数传递采用“&&万能引用”，传入左值执行拷贝，传入右值触发移动语义，尽可能减少参数传递时的语义开销
 
 private:
+    using Task = std::function<void()>;
+
     // 工作线程入口
     void Worker();
     BlockingQueue_M2M<std::function<void()>> task_queue; // 任务队列，存储可调用对象
     std::vector<std::thread> workers_; // 工作线程池，存储工作线程
 
+    /*    ********************** 工作窃取模式 **********************     */
+    void StealingWorker(size_t index);
+    void Submit(Task&& task);
+    Task* FindTask(size_t index, uint64_t& rng);
+
+    Mode mode_;
+    std::vector<std::unique_ptr<WorkStealingDeque<Task*>>> local_queues_; // 每个工作线程一个，元素是堆上的任务
+    std::deque<Task*> inject_queue_;   // 外部线程提交的任务
+    std::mutex inject_mutex_;
+    std::mutex sleep_mutex_;           // 只用于空闲线程的睡眠/唤醒
+    std::condition_variable wake_;
+    std::atomic<size_t> pending_;      // 已提交、尚未被取走的任务数
+    std::atomic<size_t> sleepers_;     // 正在睡眠的工作线程数
+    std::atomic<bool> stop_;
+
 };
 
 #endif // THREADPOOL_H
@@ -42,4 +77,6 @@ private:
  * @brief ①工作线程入口Worker()、②工作线程池 workers_ 、③务队列 task_queue 、④阻塞队列模板类的实现
  * @note 使用Post()模板接口中的std:: bind(),将任务打包成std::function<void()> 
  * 统一标准化的“无参数、无返回值”的格式，使线程池无需关心具体任务细节，只需按照统一方式执行
+ * @note 工作窃取模式下细粒度任务（任务里再 Post 子任务）几乎只操作本线程的双端队列，不再争抢同一把锁；
+ * 任务的执行顺序不再是全局先进先出，依赖提交顺序的场景应使用 SharedQueue
  */
\ No newline at end of file
@@ -5,14 +5,15 @@
 #include <functional>
 #include <chrono>
 #include <cstdint>
-#include <map>
 #include <memory>
+#include <utility>
 
+#include "containers/priority_queue.h"
 #include "tools/timertask.h"
 
 using namespace std;
 /**
- * @brief Timer的主要逻辑是通过 multimap 批量管理定时任务 “什么时候执行哪些任务”
+ * @brief Timer的主要逻辑是通过小顶堆（indexed_priority_queue）批量管理定时任务 “什么时候执行哪些任务”
  * TimerTask封装任务信息，通过函数回调机制实现自动任务的唤醒 实现定时器的异步通信 “任务信息、具体执行什么”
  */
 class Timer
@@ -37,7 +38,17 @@ public:
     int WaitTime();
     
 private:
-    std::multimap<uint64_t, std::shared_ptr<TimerTask>> m_timeouts;
+    // 堆的键为 (执行时间, 添加序号)：执行时间相同的任务按添加顺序执行，与原先 multimap 的行为一致
+    using TimeoutKey = std::pair<uint64_t, uint64_t>;
+    using TimeoutEntry = std::pair<TimeoutKey, std::shared_ptr<TimerTask>>;
+
+    // 只比较键，执行时间早的在堆顶
+    struct LaterFirst {
+        bool operator()(const TimeoutEntry& a, const TimeoutEntry& b) const { return a.first > b.first; }
+    };
+
+    simple_stl::indexed_priority_queue<TimeoutEntry, LaterFirst> m_timeouts;
+    uint64_t m_seq = 0;
 };
 
 #endif // TIMER_H
\ No newline at end of file
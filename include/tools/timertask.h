@@ -1,6 +1,7 @@
 #ifndef TIMER_TASK_H
 #define TIMER_TASK_H
 
+#include <cstddef>    // size_t
 #include <cstdint>    // uint64_t
 #include <functional> // std::function
 #include <memory>
@@ -38,6 +39,7 @@ private:
     uint64_t m_addTime;   
     uint64_t m_execTime;  
     Callback m_func;      
+    std::size_t m_handle = 0; // 在Timer堆中的句柄，由Timer维护
 };
 
 #endif // TIMER_TASK_H
\ No newline at end of file
@@ -0,0 +1,133 @@
+/**
+ * @brief Chase-Lev 工作窃取双端队列：一个所有者线程在底部 Push/Pop（后进先出），任意线程在顶部 Steal（先进先出）
+ * 所有者的 Push/Pop 在队列不只剩最后一个元素时不需要 CAS；只有窃取者之间、以及最后一个元素上才会竞争 top_
+ * T 必须是可平凡拷贝的类型（通常是指针），元素按值存放在原子槽位中
+ */
+#ifndef WORKSTEALINGDEQUE_H
+#define WORKSTEALINGDEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque stores elements in atomics");
+
+private:
+    // 环形数组，容量为2的幂；下标是不断增长的 top_/bottom_，取模得到槽位
+    struct Array
+    {
+        explicit Array(std::size_t cap) : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+        ~Array() { delete[] slots; }
+
+        T Get(std::int64_t i) const { return slots[static_cast<std::size_t>(i) & mask].load(std::memory_order_relaxed); }
+        void Put(std::int64_t i, T value) { slots[static_cast<std::size_t>(i) & mask].store(value, std::memory_order_relaxed); }
+
+        std::size_t capacity;
+        std::size_t mask;
+        std::atomic<T>* slots;
+    };
+
+    std::atomic<std::int64_t> top_;     // 窃取端
+    std::atomic<std::int64_t> bottom_;  // 所有者端
+    std::atomic<Array*> array_;
+    std::vector<Array*> retired_;       // 扩容前的旧数组：窃取者可能还在读，队列析构时才释放（只有所有者访问）
+
+    // 只由所有者在 Push 时调用：容量翻倍并拷贝 [top, bottom) 中的元素
+    Array* Grow(Array* old, std::int64_t top, std::int64_t bottom){
+        Array* bigger = new Array(old->capacity * 2);
+        for(std::int64_t i = top; i < bottom; ++i){
+            bigger->Put(i, old->Get(i));
+        }
+        retired_.push_back(old);
+        array_.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+public:
+    explicit WorkStealingDeque(std::size_t capacity = 256) : top_(0), bottom_(0) {
+        std::size_t cap = 2;
+        while(cap < capacity) cap <<= 1;
+        array_.store(new Array(cap), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque(){
+        delete array_.load(std::memory_order_relaxed);
+        for(Array* a : retired_) delete a;
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // 所有者：压入底部
+    void Push(T value){
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        Array* a = array_.load(std::memory_order_relaxed);
+        if(b - t > static_cast<std::int64_t>(a->capacity) - 1){
+            a = Grow(a, t, b);
+        }
+        a->Put(b, value);
+        // release：窃取者读到新的 bottom_ 时一定能看到槽位中的元素
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+
+    // 所有者：从底部弹出最近压入的元素，队列为空时返回 false
+    bool Pop(T& out){
+        std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Array* a = array_.load(std::memory_order_relaxed);
+        // 先占住 bottom_ 再读 top_，seq_cst 保证与窃取者“先读 top_ 再读 bottom_”之间不会互相错过
+        bottom_.store(b, std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_seq_cst);
+        if(t > b){
+            // 已经空了，恢复 bottom_
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        out = a->Get(b);
+        if(t == b){
+            // 只剩最后一个元素，与窃取者竞争 top_
+            bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // 任意线程：从顶部窃取最早压入的元素；队列为空或与其他线程竞争失败时返回 false
+    bool Steal(T& out){
+        std::int64_t t = top_.load(std::memory_order_seq_cst);
+        std::int64_t b = bottom_.load(std::memory_order_seq_cst);
+        if(t >= b){
+            return false;
+        }
+        Array* a = array_.load(std::memory_order_acquire);
+        T value = a->Get(t);
+        if(!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)){
+            return false;
+        }
+        out = value;
+        return true;
+    }
+
+    // 近似值：并发修改时只作参考
+    std::size_t Size() const{
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0;
+    }
+
+    bool Empty() const { return Size() == 0; }
+};
+
+#endif // WORKSTEALINGDEQUE_H
+
+/**
+ * @brief Push()/Pop() 只能由所有者线程调用，Steal() 可以由任意线程调用
+ * @note 所有者后进先出：刚产生的子任务数据还在本核缓存里；窃取者先进先出：偷走的是最早、通常也是最大的一块工作
+ * @note Steal() 返回 false 不代表队列为空，可能只是在 CAS 上输给了别的线程，调用方应继续尝试其他队列或重试
+ */
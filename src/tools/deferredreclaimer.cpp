@@ -0,0 +1,63 @@
+#include <tools/deferredreclaimer.h>
+
+DeferredReclaimer::DeferredReclaimer(ThreadPool& pool, std::size_t batch_size)
+    : pool_(pool), batch_size_(batch_size ? batch_size : 1), in_flight_(0) {
+    batch_.reserve(batch_size_);
+}
+
+DeferredReclaimer::~DeferredReclaimer(){
+    Drain();
+}
+
+void DeferredReclaimer::Retire(void* p, Destroy destroy){
+    std::vector<Garbage> full;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch_.push_back(Garbage{p, destroy});
+        if(batch_.size() < batch_size_){
+            return;
+        }
+        full.swap(batch_);
+        batch_.reserve(batch_size_);
+        ++in_flight_;
+    }
+    // 在锁外投递，其他线程的 Retire 不必等待任务队列
+    PostBatch(std::move(full));
+}
+
+void DeferredReclaimer::Flush(){
+    std::vector<Garbage> rest;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(batch_.empty()){
+            return;
+        }
+        rest.swap(batch_);
+        ++in_flight_;
+    }
+    PostBatch(std::move(rest));
+}
+
+void DeferredReclaimer::Drain(){
+    Flush();
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]{ return in_flight_ == 0; });
+}
+
+std::size_t DeferredReclaimer::Pending() const{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return batch_.size();
+}
+
+// 工作线程按登记顺序销毁整批对象，最后通知可能在 Drain() 中等待的线程
+void DeferredReclaimer::PostBatch(std::vector<Garbage>&& batch){
+    pool_.Post([this](std::vector<Garbage>& garbage){
+        for(const Garbage& g : garbage){
+            g.destroy(g.ptr);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(--in_flight_ == 0){
+            idle_.notify_all();
+        }
+    }, std::move(batch));
+}
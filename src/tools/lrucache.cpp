@@ -1,7 +1,7 @@
 #include "tools/lrucache.h"
 
 // 将最新使用节点插入链表头部
-void LRUCache::moveToHead(std::shared_ptr<LRUCache::ListNode> node){
+void LRUCache::moveToHead(simple_stl::local_shared_ptr<LRUCache::ListNode> node){
 
     if(node == head_ || node == tail_ || node == head_->next) return;
     // 将节点node拆下链表
@@ -19,7 +19,7 @@ void LRUCache::moveToHead(std::shared_ptr<LRUCache::ListNode> node){
 }
 
 // 移除链表尾部节点
-std::shared_ptr<LRUCache::ListNode> LRUCache::removeTail(){
+simple_stl::local_shared_ptr<LRUCache::ListNode> LRUCache::removeTail(){
     auto tailPrev = tail_->prev.lock();
     if(tailPrev == head_) return nullptr;
 
@@ -31,8 +31,9 @@ std::shared_ptr<LRUCache::ListNode> LRUCache::removeTail(){
 
 // 如果关键字 key 存在于缓存中，则返回关键字的值，否则返回 -1
 int LRUCache::get(int key){
-    if(cacheMap_.find(key) != cacheMap_.end()){
-        auto node = cacheMap_[key];
+    auto it = cacheMap_.find(key);
+    if(it != cacheMap_.end()){
+        auto node = it->second;
         moveToHead(node);
         return node->val;
     }
@@ -43,8 +44,9 @@ int LRUCache::get(int key){
 // 如果不存在，则向缓存中插入该组 key-value 。
 // 如果插入操作导致关键字数量超过 capacity ，则应该 逐出 最久未使用的关键字。
 void LRUCache::put(int key, int value){
-    if(cacheMap_.find(key) != cacheMap_.end()){
-        auto node = cacheMap_[key];
+    auto it = cacheMap_.find(key);
+    if(it != cacheMap_.end()){
+        auto node = it->second;
         moveToHead(node);
         node->val = value;
         return;
@@ -57,7 +59,7 @@ void LRUCache::put(int key, int value){
         }
     }
     
-    auto new_node = std::make_shared<ListNode>(value, key);
+    auto new_node = simple_stl::make_local_shared<ListNode>(value, key);
     moveToHead(new_node);
     cacheMap_.emplace(key, new_node);
 }
\ No newline at end of file
@@ -1,19 +1,44 @@
 #include <tools/threadpool.h>
 
+namespace {
+// 当前线程所属的线程池及其下标：工作线程内 Post 的任务进入自己的本地队列
+thread_local ThreadPool* t_pool = nullptr;
+thread_local size_t t_index = 0;
+}
+
 /**
  * @note workers_是一个线程池对象，emplace_back()会尝试在容器末尾直接构造一个与容器元素类型匹配的对象，这里是std::thread
  * lambda函数通过捕捉this指针获取获得访问 ThreadPool成员的能力，使新创建的进程执行Worker(),进入工作状态
  */
-ThreadPool::ThreadPool(int nums_threads){
-    for(size_t i = 0; i < nums_threads; i++){
+ThreadPool::ThreadPool(int nums_threads, Mode mode)
+    : mode_(mode), pending_(0), sleepers_(0), stop_(false) {
+    if(mode_ == Mode::WorkStealing){
+        // 先建好所有本地队列，工作线程启动后就可能去窃取其他线程的队列
+        for(int i = 0; i < nums_threads; i++){
+            local_queues_.emplace_back(new WorkStealingDeque<Task*>());
+        }
+        for(int i = 0; i < nums_threads; i++){
+            workers_.emplace_back([this, i]{ StealingWorker(static_cast<size_t>(i)); });
+        }
+        return;
+    }
+    for(int i = 0; i < nums_threads; i++){
         workers_.emplace_back([this]{ Worker();});
     }
 }
 
 ThreadPool::~ThreadPool(){
-    task_queue.Cancel();
+    if(mode_ == Mode::WorkStealing){
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+    }else{
+        task_queue.Cancel();
+    }
     for(auto& worker : workers_){
-        if(worker.joinable()){  
+        if(worker.joinable()){
             worker.join();
         }
     }
@@ -28,5 +53,75 @@ void ThreadPool::Worker(){
         }
         task();
     }
-    
-}
\ No newline at end of file
+
+}
+
+// 先计数再入队：工作线程看到 pending_ > 0 时任务可能还没放进队列，只会多找一轮，不会漏掉
+void ThreadPool::Submit(Task&& task){
+    Task* item = new Task(std::move(task));
+    pending_.fetch_add(1);
+    if(t_pool == this){
+        local_queues_[t_index]->Push(item);
+    }else{
+        std::lock_guard<std::mutex> lock(inject_mutex_);
+        inject_queue_.push_back(item);
+    }
+    // 与 StealingWorker 中“先登记 sleepers_ 再检查 pending_”配对，双方至少有一方看到对方的修改
+    if(sleepers_.load() > 0){
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        wake_.notify_one();
+    }
+}
+
+// 本地队列（后进先出）-> 注入队列 -> 从随机位置开始依次窃取其他线程的队列
+ThreadPool::Task* ThreadPool::FindTask(size_t index, uint64_t& rng){
+    Task* task = nullptr;
+    if(local_queues_[index]->Pop(task)){
+        return task;
+    }
+    {
+        std::lock_guard<std::mutex> lock(inject_mutex_);
+        if(!inject_queue_.empty()){
+            task = inject_queue_.front();
+            inject_queue_.pop_front();
+            return task;
+        }
+    }
+    // xorshift 随机数选择起始受害者，避免所有空闲线程同时盯着同一个队列
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    size_t n = local_queues_.size();
+    size_t start = static_cast<size_t>(rng % n);
+    for(size_t i = 0; i < n; i++){
+        size_t victim = (start + i) % n;
+        if(victim != index && local_queues_[victim]->Steal(task)){
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+// 找不到任务时睡眠，直到有新任务或线程池析构；析构时先把剩余任务执行完再退出
+void ThreadPool::StealingWorker(size_t index){
+    t_pool = this;
+    t_index = index;
+    uint64_t rng = (index + 1) * 0x9E3779B97F4A7C15ull;
+    while(true){
+        Task* task = FindTask(index, rng);
+        if(task){
+            pending_.fetch_sub(1);
+            std::unique_ptr<Task> holder(task);
+            (*holder)();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        if(stop_ && pending_.load() == 0){
+            break;
+        }
+        sleepers_.fetch_add(1);
+        wake_.wait(lock, [this]{ return pending_.load() > 0 || stop_; });
+        sleepers_.fetch_sub(1);
+    }
+    t_pool = nullptr;
+}
@@ -1,4 +1,4 @@
-/* 数据结构使用multimap、函数对象作为闭包解决异步回调、 */
+/* 数据结构使用可索引的小顶堆、函数对象作为闭包解决异步回调、 */
 /*
 什么情况下类需要继承 std::enable_shared_from_this？
 仅当需要在类的成员函数内部将 this 转换为 shared_ptr 时，见timertask::run(),需要确保this在回调函数的生命周期内存活
@@ -12,51 +12,37 @@ uint64_t Timer::GetTick() {
     return temp.count(); // 返回毫秒级时间戳，数值部分
 }
 
-// 添加定时器 
+// 添加定时器：入堆 O(log n)，并把句柄记在任务上，删除时直接定位
 std::shared_ptr<TimerTask> Timer::AddTimeout(uint64_t offset, TimerTask::Callback func) {
     auto now = GetTick();
     auto exectime = now+offset;
     auto task = std::make_shared<TimerTask>(now, exectime, std::move(func));
-    // 性能优化
-    if(m_timeouts.empty() || exectime >= m_timeouts.crbegin()->first){
-        // multimap.crbegin() 返回常量反向迭代器
-        // xx.emplace_hint() 第一个参数的插入位置，将插入操作优化为O(1)，返回值指向新插入元素本身的迭代器
-        auto ele = m_timeouts.emplace_hint(m_timeouts.end(), exectime, task);
-        return ele->second;
-    }
-    m_timeouts.emplace(exectime, task);
+    task->m_handle = m_timeouts.push(TimeoutEntry(TimeoutKey(exectime, m_seq++), task));
     return task;
 }
 
-// 删除定时器
+// 删除定时器：句柄在任务执行或删除后会被复用，需要确认句柄当前指向的仍是这个任务
 void Timer::DelTimeout(std::shared_ptr<TimerTask> task) {
-    // 查找多个将要超时的任务, 返回值为迭代器对儿，range.second迭代器指向最后一个目标的下一个位置
-    auto range = m_timeouts.equal_range(task->ExecTime()); 
-    for (auto it = range.first; it != range.second;) {
-        if (it->second == task) {
-           it = m_timeouts.erase(it);
-        } else {
-            ++it;
-        }
+    auto handle = task->m_handle;
+    if (m_timeouts.contains(handle) && m_timeouts.value(handle).second == task) {
+        m_timeouts.erase(handle);
     }
 }
 
 // 更新定时器：批量处理到期任务
 void Timer::Update(uint64_t now) {
-    auto it = m_timeouts.begin();
-    while (it != m_timeouts.end() && it->first <= now) {
-        it->second->run();
-        // delete it->second; 如果没有使用智能指针，原始指针可以手动删除
-        it = m_timeouts.erase(it); // 返回值为被删除元素的下一个迭代器
+    while (!m_timeouts.empty() && m_timeouts.top().first.first <= now) {
+        // 先出堆再执行：回调中可能再添加或删除定时器
+        auto task = m_timeouts.take_top().second;
+        task->run();
     }
 }
 
 // 获取最近的超时时间
 int Timer::WaitTime() {
-    auto it = m_timeouts.begin();
-    if (it == m_timeouts.end()) {
+    if (m_timeouts.empty()) {
         return -1;
     }
-    int diss = it->first - GetTick();
+    int diss = m_timeouts.top().first.first - GetTick();
     return diss > 0 ? diss : 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,116 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "common/atomic_shared_ptr.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// 配置快照：两个字段必须一致，读到“撕裂”的快照说明发布不是原子的
+struct Config {
+    static std::atomic<int> alive;
+    int version;
+    int doubled;
+    explicit Config(int v) : version(v), doubled(v * 2) { ++alive; }
+    ~Config() { --alive; }
+};
+std::atomic<int> Config::alive{0};
+
+TEST_CASE("单线程语义", "[atomic_shared_ptr]") {
+    {
+        simple_stl::atomic_shared_ptr<Config> cfg;
+        REQUIRE(cfg.is_lock_free());
+        REQUIRE(cfg.load() == nullptr);
+
+        auto first = simple_stl::make_shared<Config>(1);
+        cfg.store(first);
+        REQUIRE(cfg.load() == first);
+        REQUIRE(first.use_count() == 2); // first 自己 + 原子变量内部的一份，load 得到的临时快照已释放
+        REQUIRE(cfg.load().use_count() == 3);
+        auto old = cfg.exchange(simple_stl::make_shared<Config>(2));
+        REQUIRE(old == first);
+        REQUIRE(first.use_count() == 2);
+        REQUIRE(cfg.load()->version == 2);
+
+        // compare_exchange：失败时 expected 被更新为当前值
+        auto expected = first;
+        REQUIRE(!cfg.compare_exchange_strong(expected, simple_stl::make_shared<Config>(3)));
+        REQUIRE(expected->version == 2);
+        REQUIRE(cfg.compare_exchange_strong(expected, simple_stl::make_shared<Config>(3)));
+        REQUIRE(cfg.load()->version == 3);
+
+        // 同一对象的别名指针不等价（所有者相同但 get() 不同）
+        simple_stl::shared_ptr<Config> cur = cfg;
+        simple_stl::shared_ptr<Config> alias(cur, nullptr);
+        REQUIRE(!cfg.compare_exchange_weak(alias, nullptr));
+        REQUIRE(cfg.compare_exchange_weak(cur, nullptr));
+        REQUIRE(cfg.load() == nullptr);
+        simple_stl::shared_ptr<Config> none;
+        REQUIRE(cfg.compare_exchange_strong(none, first));
+        cfg = nullptr;
+        old.reset();
+        first.reset();
+        expected.reset();
+        cur.reset();
+        alias.reset();
+        REQUIRE(Config::alive == 0);
+        cfg = simple_stl::make_shared<Config>(4);
+    }
+    // 析构释放最后一个快照
+    REQUIRE(Config::alive == 0);
+}
+
+TEST_CASE("读者并发 load，写者并发 store", "[atomic_shared_ptr]") {
+    {
+        simple_stl::atomic_shared_ptr<Config> cfg(simple_stl::make_shared<Config>(0));
+        std::atomic<bool> stop{false};
+        std::atomic<long> torn{0};
+        std::vector<std::thread> threads;
+        for (int r = 0; r < 6; ++r) {
+            threads.emplace_back([&] {
+                int last = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    auto snap = cfg.load();
+                    if (snap->doubled != snap->version * 2) ++torn;
+                    // 单个写者递增版本，读者看到的版本不会倒退
+                    if (snap->version < last) ++torn;
+                    last = snap->version;
+                }
+            });
+        }
+        for (int v = 1; v <= 20000; ++v) cfg.store(simple_stl::make_shared<Config>(v));
+        stop = true;
+        for (auto& t : threads) t.join();
+        REQUIRE(torn == 0);
+        REQUIRE(cfg.load()->version == 20000);
+    }
+    REQUIRE(Config::alive == 0);
+}
+
+TEST_CASE("compare_exchange 实现无锁计数器", "[atomic_shared_ptr]") {
+    {
+        simple_stl::atomic_shared_ptr<Config> cfg(simple_stl::make_shared<Config>(0));
+        const int kThreads = 6, kIncrements = 3000;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < kIncrements; ++i) {
+                    auto cur = cfg.load();
+                    while (!cfg.compare_exchange_weak(cur, simple_stl::make_shared<Config>(cur->version + 1))) {}
+                }
+            });
+        }
+        // 同时有读者在拷贝快照
+        std::atomic<long> torn{0};
+        std::thread reader([&] {
+            for (int i = 0; i < 20000; ++i) {
+                auto snap = cfg.load();
+                if (snap->doubled != snap->version * 2) ++torn;
+            }
+        });
+        for (auto& t : threads) t.join();
+        reader.join();
+        REQUIRE(torn == 0);
+        REQUIRE(cfg.load()->version == kThreads * kIncrements);
+    }
+    REQUIRE(Config::alive == 0);
+}
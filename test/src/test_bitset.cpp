@@ -0,0 +1,140 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/bitset.h"
+#include <bitset>
+#include <random>
+#include <vector>
+
+using simple_stl::dynamic_bitset;
+
+TEST_CASE("字内操作", "[bitset]") {
+    namespace bd = simple_stl::bit_detail;
+    REQUIRE(bd::popcount(0) == 0);
+    REQUIRE(bd::popcount(~0ULL) == 64);
+    REQUIRE(bd::ctz(1ULL << 63) == 63);
+    REQUIRE(bd::select_in_word(0b101100, 0) == 2);
+    REQUIRE(bd::select_in_word(0b101100, 2) == 5);
+    REQUIRE(bd::tail_mask(64) == ~0ULL);
+    REQUIRE(bd::tail_mask(3) == 0b111);
+}
+
+TEST_CASE("bitset<N> 与 std::bitset 对拍", "[bitset]") {
+    constexpr std::size_t N = 200;
+    simple_stl::bitset<N> a, b;
+    std::bitset<N> ra, rb;
+    std::mt19937 rng(5);
+    for (int i = 0; i < 300; ++i) {
+        std::size_t p = rng() % N, q = rng() % N;
+        a.set(p); ra.set(p);
+        b.flip(q); rb.flip(q);
+    }
+    REQUIRE(a.to_string() == ra.to_string());
+    REQUIRE(a.count() == ra.count());
+    REQUIRE((a & b).to_string() == (ra & rb).to_string());
+    REQUIRE((a | b).to_string() == (ra | rb).to_string());
+    REQUIRE((a ^ b).to_string() == (ra ^ rb).to_string());
+    REQUIRE((~a).to_string() == (~ra).to_string());
+    REQUIRE((~a).count() == N - a.count());
+    auto diff = a;
+    diff.and_not(b);
+    REQUIRE(diff.to_string() == (ra & ~rb).to_string());
+
+    simple_stl::bitset<N> full;
+    full.set();
+    REQUIRE(full.all());
+    REQUIRE(full.count() == N);
+    REQUIRE(full == ~simple_stl::bitset<N>());
+    REQUIRE_THROWS_AS(full.test(N), std::out_of_range);
+    REQUIRE(simple_stl::bitset<N>(0b1010).to_string() == std::bitset<N>(0b1010).to_string());
+    REQUIRE(simple_stl::bitset<N>().none());
+}
+
+TEST_CASE("find_first/find_next 遍历置位", "[bitset]") {
+    simple_stl::bitset<300> s;
+    std::vector<std::size_t> expect{0, 63, 64, 130, 299};
+    for (std::size_t p : expect) s.set(p);
+    std::vector<std::size_t> got;
+    for (std::size_t i = s.find_first(); i != s.npos; i = s.find_next(i)) got.push_back(i);
+    REQUIRE(got == expect);
+    REQUIRE(simple_stl::bitset<10>().find_first() == simple_stl::bitset<10>::npos);
+    REQUIRE(s.rank(64) == 2);
+    REQUIRE(s.rank(300) == 5);
+    REQUIRE(s.select(3) == 130);
+    REQUIRE(s.select(5) == s.npos);
+}
+
+TEST_CASE("dynamic_bitset 大小调整", "[bitset]") {
+    dynamic_bitset<> d(70, true);
+    REQUIRE(d.count() == 70);
+    REQUIRE(d.num_words() == 2);
+    d.resize(130, false);
+    REQUIRE(d.count() == 70);
+    d.resize(140, true);
+    REQUIRE(d.count() == 80);
+    REQUIRE(d.test(139));
+    REQUIRE(!d.test(100));
+    d.resize(65);
+    REQUIRE(d.count() == 65);
+    d.flip();
+    REQUIRE(d.none());
+    d.push_back(true);
+    REQUIRE(d.size() == 66);
+    REQUIRE(d.count() == 1);
+    REQUIRE(d.find_first() == 65);
+    REQUIRE_THROWS_AS(d.set(66), std::out_of_range);
+    d.clear();
+    REQUIRE(d.empty());
+}
+
+TEST_CASE("dynamic_bitset 集合运算与 rank/select", "[bitset]") {
+    const std::size_t n = 100000;
+    dynamic_bitset<> a(n), b(n);
+    std::vector<bool> ra(n), rb(n);
+    std::mt19937 rng(11);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (rng() % 3 == 0) { a.set(i); ra[i] = true; }
+        if (rng() % 5 == 0) { b.set(i); rb[i] = true; }
+    }
+
+    std::size_t inter = 0;
+    for (std::size_t i = 0; i < n; ++i) inter += ra[i] && rb[i];
+    REQUIRE(a.count_and(b) == inter);
+    REQUIRE((a & b).count() == inter);
+    auto u = a | b;
+    auto x = a ^ b;
+    auto d = a;
+    d.and_not(b);
+    for (std::size_t i = 0; i < n; i += 97) {
+        REQUIRE(u[i] == (ra[i] || rb[i]));
+        REQUIRE(x[i] == (ra[i] != rb[i]));
+        REQUIRE(d[i] == (ra[i] && !rb[i]));
+    }
+    REQUIRE(u.count() + (a & b).count() == a.count() + b.count());
+
+    // 建索引前后 rank/select 结果一致
+    std::vector<std::size_t> ranks, selects;
+    for (std::size_t p = 0; p <= n; p += 1234) ranks.push_back(a.rank(p));
+    for (std::size_t k = 0; k < a.count(); k += 777) selects.push_back(a.select(k));
+    a.build_rank_index();
+    REQUIRE(a.has_rank_index());
+    std::size_t idx = 0;
+    for (std::size_t p = 0; p <= n; p += 1234) REQUIRE(a.rank(p) == ranks[idx++]);
+    idx = 0;
+    for (std::size_t k = 0; k < a.count(); k += 777) REQUIRE(a.select(k) == selects[idx++]);
+    REQUIRE(a.select(a.count()) == a.npos);
+
+    // select(rank(p)) 是 p 及其之后的第一个置位
+    for (std::size_t p = 0; p < n; p += 311) {
+        std::size_t s = a.select(a.rank(p));
+        std::size_t expect = p;
+        while (expect < n && !ra[expect]) ++expect;
+        REQUIRE(s == (expect == n ? a.npos : expect));
+    }
+
+    a.set(0, !a[0]);
+    REQUIRE(!a.has_rank_index());
+
+    dynamic_bitset<> shorter(10);
+    REQUIRE_THROWS_AS(a &= shorter, std::invalid_argument);
+    REQUIRE_THROWS_AS(a.count_and(shorter), std::invalid_argument);
+}
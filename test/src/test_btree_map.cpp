@@ -0,0 +1,127 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/btree_map.h"
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// 小节点让树在少量元素时就有多层，充分覆盖分裂、借位与合并
+template <typename K, typename V>
+using small_btree = simple_stl::btree_map<K, V, std::less<K>, simple_stl::allocator<std::pair<const K, V>>, 64>;
+
+template <typename Map, typename Ref>
+static void require_same(const Map& map, const Ref& ref) {
+    REQUIRE(map.size() == ref.size());
+    auto rit = ref.begin();
+    for (const auto& kv : map) {
+        REQUIRE(kv.first == rit->first);
+        REQUIRE(kv.second == rit->second);
+        ++rit;
+    }
+    REQUIRE(rit == ref.end());
+}
+
+TEST_CASE("节点容量", "[btree_map]") {
+    REQUIRE(small_btree<int, int>::leaf_capacity >= 3);
+    REQUIRE(small_btree<int, int>::internal_capacity >= 3);
+    // 默认256字节节点：int->int 的叶子一次能放几十个元素
+    REQUIRE(simple_stl::btree_map<int, int>::leaf_capacity >= 25);
+}
+
+TEST_CASE("与 std::map 随机对拍", "[btree_map]") {
+    small_btree<int, int> map;
+    std::map<int, int> ref;
+    std::mt19937 rng(2024);
+    for (int step = 0; step < 100000; ++step) {
+        int k = static_cast<int>(rng() % 3000);
+        switch (rng() % 4) {
+        case 0:
+        case 1:
+            REQUIRE(map.insert_or_assign(k, step).second == ref.insert_or_assign(k, step).second);
+            break;
+        case 2:
+            REQUIRE(map.erase(k) == ref.erase(k));
+            break;
+        default: {
+            auto lb = map.lower_bound(k);
+            auto rlb = ref.lower_bound(k);
+            REQUIRE((lb == map.end()) == (rlb == ref.end()));
+            if (rlb != ref.end()) REQUIRE(lb->first == rlb->first);
+            auto ub = map.upper_bound(k);
+            auto rub = ref.upper_bound(k);
+            REQUIRE((ub == map.end()) == (rub == ref.end()));
+            if (rub != ref.end()) REQUIRE(ub->first == rub->first);
+        }
+        }
+        if (step % 10000 == 0) require_same(map, ref);
+    }
+    require_same(map, ref);
+
+    // 全部删光，树应回到空状态
+    for (auto& kv : ref) REQUIRE(map.erase(kv.first) == 1);
+    REQUIRE(map.empty());
+    REQUIRE(map.height() == 0);
+    REQUIRE(map.begin() == map.end());
+}
+
+TEST_CASE("顺序插入时叶子是满的", "[btree_map]") {
+    small_btree<int, int> seq;
+    small_btree<int, int> bulk;
+    std::vector<std::pair<int, int>> src;
+    for (int i = 0; i < 10000; ++i) {
+        seq[i] = i;
+        src.push_back({i, i});
+    }
+    bulk.bulk_load(src.begin(), src.end());
+    REQUIRE(seq == bulk);
+    // 追加写入不对半分裂，树高与批量构建的接近
+    REQUIRE(seq.height() <= bulk.height() + 1);
+
+    REQUIRE_THROWS_AS(bulk.bulk_load(src.rbegin(), src.rend()), std::invalid_argument);
+    REQUIRE(bulk.size() == 10000); // 输入非法时原内容不变
+}
+
+TEST_CASE("迭代器、区间删除与拷贝", "[btree_map]") {
+    std::vector<std::pair<std::string, int>> src;
+    for (int i = 0; i < 500; ++i) {
+        char buf[8];
+        std::snprintf(buf, sizeof(buf), "k%04d", i);
+        src.push_back({buf, i});
+    }
+    small_btree<std::string, int> map(simple_stl::sorted_unique, src.begin(), src.end());
+    REQUIRE(map.size() == 500);
+    REQUIRE(map.at("k0042") == 42);
+    REQUIRE_THROWS_AS(map.at("nope"), std::out_of_range);
+
+    // 反向遍历
+    int expected = 499;
+    for (auto it = map.rbegin(); it != map.rend(); ++it) REQUIRE(it->second == expected--);
+
+    // 区间删除 [k0100, k0400)
+    auto it = map.erase(map.find("k0100"), map.find("k0400"));
+    REQUIRE(it->first == "k0400");
+    REQUIRE(map.size() == 200);
+    REQUIRE(std::prev(it)->first == "k0099");
+
+    // 遍历中删除偶数
+    for (auto i = map.begin(); i != map.end();) {
+        if (i->second % 2 == 0) i = map.erase(i);
+        else ++i;
+    }
+    REQUIRE(map.size() == 100);
+
+    small_btree<std::string, int> copy(map);
+    REQUIRE(copy == map);
+    copy["k0001"] = -1;
+    REQUIRE(copy != map);
+
+    small_btree<std::string, int> moved(std::move(copy));
+    REQUIRE(copy.empty());
+    REQUIRE(moved.at("k0001") == -1);
+    moved.erase(moved.begin(), moved.end());
+    REQUIRE(moved.empty());
+    REQUIRE(moved.try_emplace("a", 1).second);
+}
@@ -0,0 +1,97 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/concurrent_list.h"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename List>
+static std::vector<typename List::value_type> collect(const List& list) {
+    std::vector<typename List::value_type> out;
+    for (const auto& v : list) out.push_back(v);
+    return out;
+}
+
+TEST_CASE("单线程顺序语义", "[concurrent_list]") {
+    simple_stl::concurrent_list<std::string> list;
+    REQUIRE(list.empty());
+    list.push_back("b");
+    list.push_front("a");
+    list.emplace_back(3, 'c');
+    std::vector<std::string> out = collect(list);
+    REQUIRE(out == std::vector<std::string>{"a", "b", "ccc"});
+    REQUIRE(list.size() == 3);
+
+    list.clear();
+    REQUIRE(list.empty());
+    list.push_front("x"); // 清空后 tail_ 复位，尾插依旧正确
+    list.push_back("y");
+    REQUIRE(collect(list) == std::vector<std::string>{"x", "y"});
+}
+
+TEST_CASE("多生产者并发头插尾插", "[concurrent_list][thread_safety]") {
+    simple_stl::concurrent_list<int> list;
+    const int kThreads = 8;
+    const int kPerThread = 20000;
+    std::atomic<bool> done(false);
+    std::atomic<long> max_seen(0);
+    std::atomic<bool> bad_value(false); // Catch2 断言不是线程安全的，读线程只记录结果
+
+    // 读线程在插入期间持续遍历
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            long n = 0;
+            for (int v : list) {
+                if (v < 0) bad_value.store(true);
+                ++n;
+            }
+            if (n > max_seen.load()) max_seen.store(n);
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < kThreads; ++t) {
+        writers.emplace_back([&list, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                int v = t * kPerThread + i;
+                if (i % 2 == 0) {
+                    list.push_back(v);
+                } else {
+                    list.push_front(v);
+                }
+            }
+        });
+    }
+    for (auto& w : writers) w.join();
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    REQUIRE(list.size() == static_cast<size_t>(kThreads * kPerThread));
+    std::vector<int> all = collect(list);
+    REQUIRE(all.size() == static_cast<size_t>(kThreads * kPerThread));
+    std::sort(all.begin(), all.end());
+    for (int i = 0; i < kThreads * kPerThread; ++i) {
+        REQUIRE(all[i] == i); // 每个元素恰好出现一次
+    }
+    REQUIRE_FALSE(bad_value.load());
+    REQUIRE(max_seen.load() <= kThreads * kPerThread);
+}
+
+TEST_CASE("同一线程的尾插顺序保持不变", "[concurrent_list][thread_safety]") {
+    simple_stl::concurrent_list<std::pair<int, int>> list;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&list, t] {
+            for (int i = 0; i < 10000; ++i) list.emplace_back(t, i);
+        });
+    }
+    for (auto& w : writers) w.join();
+
+    int last[4] = {-1, -1, -1, -1};
+    for (const auto& p : list) {
+        REQUIRE(p.second > last[p.first]);
+        last[p.first] = p.second;
+    }
+}
@@ -0,0 +1,76 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "tools/deferredreclaimer.h"
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+// 记录析构发生在哪个线程
+struct Heavy {
+    static std::atomic<int> alive;
+    static std::mutex mutex;
+    static std::set<std::thread::id> destroyed_on;
+    std::vector<int> payload;
+    explicit Heavy(int n) : payload(n, n) { ++alive; }
+    ~Heavy() {
+        std::lock_guard<std::mutex> lock(mutex);
+        destroyed_on.insert(std::this_thread::get_id());
+        --alive;
+    }
+};
+std::atomic<int> Heavy::alive{0};
+std::mutex Heavy::mutex;
+std::set<std::thread::id> Heavy::destroyed_on;
+
+TEST_CASE("最后一个引用释放后对象在线程池中析构", "[deferred_reclaimer]") {
+    Heavy::destroyed_on.clear();
+    ThreadPool pool(2);
+    DeferredReclaimer reclaimer(pool, 4);
+    {
+        auto a = reclaimer.MakeShared<Heavy>(1000);
+        auto b = a;
+        simple_stl::shared_ptr<Heavy> c(new Heavy(10), deferred_delete<Heavy>(reclaimer));
+        REQUIRE(Heavy::alive == 2);
+    }
+    // 批次未满，只是登记
+    REQUIRE(reclaimer.Pending() == 2);
+    REQUIRE(Heavy::alive == 2);
+    reclaimer.Drain();
+    REQUIRE(reclaimer.Pending() == 0);
+    REQUIRE(Heavy::alive == 0);
+    REQUIRE(Heavy::destroyed_on.count(std::this_thread::get_id()) == 0);
+}
+
+TEST_CASE("批次攒满自动投递", "[deferred_reclaimer]") {
+    ThreadPool pool(1);
+    DeferredReclaimer reclaimer(pool, 8);
+    for (int i = 0; i < 7; ++i) reclaimer.Retire(new Heavy(1));
+    REQUIRE(reclaimer.Pending() == 7);
+    reclaimer.Retire(new Heavy(1));
+    REQUIRE(reclaimer.Pending() == 0);
+    reclaimer.Drain();
+    REQUIRE(Heavy::alive == 0);
+}
+
+TEST_CASE("多线程并发释放", "[deferred_reclaimer]") {
+    Heavy::destroyed_on.clear();
+    {
+        ThreadPool pool(2);
+        DeferredReclaimer reclaimer(pool, 16);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&reclaimer] {
+                for (int i = 0; i < 1000; ++i) {
+                    auto p = reclaimer.MakeShared<Heavy>(16);
+                    auto q = p;
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+        // 析构 reclaimer 时 Drain，之后才析构 pool
+    }
+    REQUIRE(Heavy::alive == 0);
+    REQUIRE(Heavy::destroyed_on.count(std::this_thread::get_id()) == 0);
+}
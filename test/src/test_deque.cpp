@@ -0,0 +1,175 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/deque.h"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// 小块让少量元素就跨越多个块，覆盖换块与 map 重新分配
+template <typename T>
+using small_deque = simple_stl::deque<T, simple_stl::allocator<T>, 16>;
+
+template <typename D, typename Ref>
+static void require_same(const D& d, const Ref& ref) {
+    REQUIRE(d.size() == ref.size());
+    REQUIRE(std::equal(d.begin(), d.end(), ref.begin(), ref.end()));
+    for (std::size_t i = 0; i < ref.size(); ++i) REQUIRE(d[i] == ref[i]);
+}
+
+TEST_CASE("块大小", "[deque]") {
+    REQUIRE(simple_stl::deque<char>::block_size == 512);
+    REQUIRE(simple_stl::deque<std::int64_t>::block_size == 64);
+    // 大对象至少16个一块
+    struct Big { char data[256]; };
+    REQUIRE(simple_stl::deque<Big>::block_size == 16);
+}
+
+TEST_CASE("两端插入删除与 std::deque 对拍", "[deque]") {
+    small_deque<int> d;
+    std::deque<int> ref;
+    std::mt19937 rng(7);
+    for (int step = 0; step < 50000; ++step) {
+        switch (rng() % 4) {
+        case 0: d.push_back(step); ref.push_back(step); break;
+        case 1: d.push_front(step); ref.push_front(step); break;
+        case 2: if (!ref.empty()) { d.pop_back(); ref.pop_back(); } break;
+        default: if (!ref.empty()) { d.pop_front(); ref.pop_front(); } break;
+        }
+        REQUIRE(d.size() == ref.size());
+        if (!ref.empty()) {
+            REQUIRE(d.front() == ref.front());
+            REQUIRE(d.back() == ref.back());
+        }
+        if (step % 5000 == 0) require_same(d, ref);
+    }
+    require_same(d, ref);
+}
+
+TEST_CASE("两端插入不使已有元素的地址失效", "[deque]") {
+    small_deque<int> d;
+    d.push_back(0);
+    std::vector<int*> addrs{&d.front()};
+    for (int i = 1; i <= 2000; ++i) {
+        if (i % 2) {
+            d.push_back(i);
+            addrs.push_back(&d.back());
+        } else {
+            d.push_front(i);
+            addrs.push_back(&d.front());
+        }
+    }
+    // map 已经多次重新分配，但每个元素仍在原地址上
+    REQUIRE(*addrs[0] == 0);
+    for (std::size_t i = 1; i < addrs.size(); ++i) REQUIRE(*addrs[i] == static_cast<int>(i));
+}
+
+TEST_CASE("随机访问迭代器", "[deque]") {
+    small_deque<int> d;
+    for (int i = 0; i < 100; ++i) d.push_back(i);
+    for (int i = 1; i <= 100; ++i) d.push_front(-i);
+
+    REQUIRE(d.end() - d.begin() == 200);
+    auto it = d.begin();
+    for (int n = 0; n < 200; n += 7) {
+        REQUIRE(*(it + n) == n - 100);
+        REQUIRE((it + n) - it == n);
+        REQUIRE((d.end() - (200 - n)) == it + n);
+        REQUIRE(it[n] == n - 100);
+    }
+    auto back = d.end() - 1;
+    REQUIRE(*(back - 150) == -51);
+    REQUIRE(it < back);
+    REQUIRE(back >= it);
+
+    // 标准算法可以直接作用于 deque
+    std::vector<int> shuffled(d.begin(), d.end());
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(1));
+    small_deque<int> s(shuffled.begin(), shuffled.end());
+    std::sort(s.begin(), s.end());
+    REQUIRE(std::is_sorted(s.begin(), s.end()));
+    REQUIRE(*std::lower_bound(s.begin(), s.end(), 42) == 42);
+
+    std::vector<int> reversed(d.rbegin(), d.rend());
+    REQUIRE(reversed.front() == 99);
+    REQUIRE(reversed.back() == -100);
+
+    const small_deque<int>& cd = d;
+    small_deque<int>::const_iterator cit = d.begin();
+    REQUIRE(cit == cd.begin());
+    REQUIRE(*(cd.cend() - 1) == 99);
+}
+
+TEST_CASE("工作队列模式复用空闲块", "[deque]") {
+    small_deque<int> d;
+    for (int i = 0; i < 64; ++i) d.push_back(i);
+    for (int round = 0; round < 10000; ++round) {
+        d.push_back(round);
+        d.pop_front();
+    }
+    // 稳定状态下只在空闲链表和使用中的块之间周转，空闲块数量有界
+    REQUIRE(d.spare_blocks() <= 1);
+    REQUIRE(d.size() == 64);
+    REQUIRE(d.front() == 10000 - 64);
+
+    while (!d.empty()) d.pop_back();
+    REQUIRE(d.spare_blocks() > 0);
+    d.shrink_to_fit();
+    REQUIRE(d.spare_blocks() == 0);
+    d.push_front(1);
+    REQUIRE(d.front() == 1);
+}
+
+TEST_CASE("构造、拷贝、移动与 clear", "[deque]") {
+    small_deque<std::string> d{"a", "b", "c"};
+    for (int i = 0; i < 50; ++i) d.push_front(std::to_string(i));
+
+    small_deque<std::string> copy(d);
+    REQUIRE(copy == d);
+    small_deque<std::string> moved(std::move(copy));
+    REQUIRE(moved == d);
+    REQUIRE(copy.empty());
+    copy.push_back("x");
+    REQUIRE(copy.back() == "x");
+
+    small_deque<std::string> assigned;
+    assigned = d;
+    REQUIRE(assigned == d);
+    assigned = std::move(moved);
+    REQUIRE(assigned == d);
+
+    d.clear();
+    REQUIRE(d.empty());
+    REQUIRE(d.begin() == d.end());
+    d.push_back("y");
+    d.push_front("z");
+    REQUIRE(d.size() == 2);
+    REQUIRE(d[0] == "z");
+    REQUIRE(d.at(1) == "y");
+    REQUIRE_THROWS_AS(d.at(2), std::out_of_range);
+
+    small_deque<int> n(40, 3);
+    REQUIRE(n.size() == 40);
+    n.resize(10);
+    REQUIRE(n.size() == 10);
+    n.resize(20, 5);
+    REQUIRE(n.back() == 5);
+    REQUIRE(n[9] == 3);
+
+    small_deque<int> empty;
+    REQUIRE_THROWS_AS(empty.pop_back(), std::out_of_range);
+    REQUIRE_THROWS_AS(empty.pop_front(), std::out_of_range);
+}
+
+TEST_CASE("只可移动的元素", "[deque]") {
+    small_deque<std::unique_ptr<int>> d;
+    for (int i = 0; i < 100; ++i) {
+        d.push_back(std::make_unique<int>(i));
+        d.emplace_front(new int(-i));
+    }
+    REQUIRE(*d.front() == -99);
+    REQUIRE(*d.back() == 99);
+}
@@ -0,0 +1,158 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "common/epoch.h"
+#include "common/allocator.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+struct Tracked {
+    static std::atomic<int> alive;
+    int value;
+    explicit Tracked(int v) : value(v) { ++alive; }
+    Tracked(const Tracked& other) : value(other.value) { ++alive; }
+    Tracked& operator=(const Tracked&) = default;
+    ~Tracked() { --alive; }
+};
+std::atomic<int> Tracked::alive{0};
+
+TEST_CASE("活跃的读者阻止回收", "[epoch]") {
+    simple_stl::epoch_domain domain;
+    std::atomic<bool> pinned{false};
+    std::atomic<bool> release{false};
+    std::thread reader([&] {
+        auto g = domain.pin();
+        pinned = true;
+        while (!release) std::this_thread::yield();
+    });
+    while (!pinned) std::this_thread::yield();
+
+    domain.retire(new Tracked(1));
+    for (int i = 0; i < 10; ++i) domain.collect();
+    // 读者停在旧 epoch，最多推进一步，退休对象不能释放
+    REQUIRE(domain.pending() == 1);
+    REQUIRE(Tracked::alive == 1);
+
+    release = true;
+    reader.join();
+    domain.synchronize();
+    REQUIRE(domain.pending() == 0);
+    REQUIRE(Tracked::alive == 0);
+
+    // 嵌套 pin 只在最外层退出时离开临界区
+    {
+        auto outer = domain.pin();
+        { auto inner = domain.pin(); }
+        std::uint64_t e = domain.epoch();
+        REQUIRE(domain.try_advance());
+        REQUIRE(!domain.try_advance());
+        REQUIRE(domain.epoch() == e + 1);
+    }
+    REQUIRE(domain.try_advance());
+}
+
+TEST_CASE("domain 析构释放未回收的对象", "[epoch]") {
+    {
+        simple_stl::epoch_domain domain(1000);
+        for (int i = 0; i < 10; ++i) domain.retire(new Tracked(i));
+        std::thread other([&] { domain.retire(new Tracked(-1)); });
+        other.join();
+        REQUIRE(Tracked::alive == 11);
+    }
+    REQUIRE(Tracked::alive == 0);
+    // 线程在 domain 析构之后退出：记录由线程自己释放
+    std::thread late;
+    {
+        simple_stl::epoch_domain domain;
+        std::atomic<bool> registered{false};
+        std::atomic<bool> done{false};
+        late = std::thread([&] {
+            domain.retire(new Tracked(0));
+            registered = true;
+            while (!done) std::this_thread::yield();
+        });
+        while (!registered) std::this_thread::yield();
+        // domain 析构前读取完成，之后线程不再访问 domain
+        done = true;
+        late.join();
+    }
+    REQUIRE(Tracked::alive == 0);
+}
+
+// 用 EBR 保护的 Treiber 栈：pop 摘下的节点可能仍被其他线程读取，交给 domain 延迟释放
+template <typename T>
+class ebr_stack {
+    struct Node {
+        T value;
+        Node* next;
+        template <typename... Args>
+        explicit Node(Args&&... args) : value(std::forward<Args>(args)...), next(nullptr) {}
+    };
+    using NodeAllocator = simple_stl::allocator<Node>;
+
+public:
+    explicit ebr_stack(simple_stl::epoch_domain& domain) : domain_(domain), head_(nullptr) {}
+    ~ebr_stack() {
+        Node* n = head_.load();
+        while (n) {
+            Node* next = n->next;
+            alloc_.destroy(n);
+            alloc_.deallocate(n, 1);
+            n = next;
+        }
+    }
+
+    void push(const T& v) {
+        Node* n = alloc_.allocate(1);
+        alloc_.construct(n, v);
+        n->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(n->next, n, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    bool pop(T& out) {
+        auto g = domain_.pin();
+        Node* n = head_.load(std::memory_order_acquire);
+        // 读取 n->next 时 n 可能已被其他线程弹出并退休，但在本 guard 内不会被释放
+        while (n && !head_.compare_exchange_weak(n, n->next, std::memory_order_acquire, std::memory_order_acquire)) {}
+        if (!n) return false;
+        out = n->value;
+        domain_.retire(n, alloc_);
+        return true;
+    }
+
+private:
+    simple_stl::epoch_domain& domain_;
+    std::atomic<Node*> head_;
+    NodeAllocator alloc_;
+};
+
+TEST_CASE("并发栈的节点回收", "[epoch]") {
+    simple_stl::epoch_domain domain(32);
+    {
+        ebr_stack<Tracked> stack(domain);
+        const int kThreads = 4, kOps = 20000;
+        std::atomic<long> popped_sum{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&, t] {
+                long sum = 0;
+                for (int i = 0; i < kOps; ++i) {
+                    stack.push(Tracked(t * kOps + i));
+                    Tracked out(0);
+                    if (stack.pop(out)) sum += out.value;
+                }
+                popped_sum += sum;
+                domain.synchronize();
+            });
+        }
+        for (auto& t : threads) t.join();
+        Tracked out(0);
+        long rest = 0;
+        while (stack.pop(out)) rest += out.value;
+        long n = static_cast<long>(kThreads) * kOps;
+        REQUIRE(popped_sum + rest == n * (n - 1) / 2);
+    }
+    domain.synchronize();
+    REQUIRE(domain.pending() == 0);
+    REQUIRE(Tracked::alive == 0);
+}
@@ -0,0 +1,164 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/flat_hash_map.h"
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+TEST_CASE("基本插入、查找与删除", "[flat_hash_map]") {
+    simple_stl::flat_hash_map<int, int> map;
+    REQUIRE(map.empty());
+    REQUIRE(map.find(1) == map.end());
+    REQUIRE(map.begin() == map.end()); // 空表不分配内存也能安全遍历
+
+    for (int i = 0; i < 1000; ++i) {
+        auto res = map.insert({i, i * 2});
+        REQUIRE(res.second);
+        REQUIRE(res.first->second == i * 2);
+    }
+    REQUIRE(map.size() == 1000);
+    REQUIRE_FALSE(map.insert({5, 0}).second); // 重复键不覆盖
+    REQUIRE(map.at(5) == 10);
+    REQUIRE_THROWS_AS(map.at(-1), std::out_of_range);
+    REQUIRE(map.load_factor() <= map.max_load_factor());
+
+    map[5] = 50;
+    REQUIRE(map[5] == 50);
+    REQUIRE(map[2000] == 0); // operator[] 值初始化
+    REQUIRE(map.insert_or_assign(2000, 7).second == false);
+    REQUIRE(map.at(2000) == 7);
+
+    REQUIRE(map.erase(5) == 1);
+    REQUIRE(map.erase(5) == 0);
+    REQUIRE_FALSE(map.contains(5));
+    REQUIRE(map.count(6) == 1);
+
+    long long sum = 0;
+    size_t n = 0;
+    for (const auto& kv : map) {
+        sum += kv.first;
+        ++n;
+    }
+    REQUIRE(n == map.size());
+    REQUIRE(sum == 999LL * 1000 / 2 - 5 + 2000);
+
+    // 遍历中按迭代器删除
+    for (auto it = map.begin(); it != map.end();) {
+        if (it->first % 2) it = map.erase(it);
+        else ++it;
+    }
+    REQUIRE(map.size() == 501);
+    for (const auto& kv : map) REQUIRE(kv.first % 2 == 0);
+
+    size_t cap = map.capacity();
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE(map.capacity() == cap); // clear 保留内存
+    REQUIRE(map.begin() == map.end());
+}
+
+TEST_CASE("与 std::unordered_map 随机对拍（大量墓碑）", "[flat_hash_map]") {
+    simple_stl::flat_hash_map<int, int> map;
+    std::unordered_map<int, int> ref;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> key(0, 2000);
+    for (int step = 0; step < 200000; ++step) {
+        int k = key(rng);
+        switch (rng() % 3) {
+        case 0:
+            REQUIRE(map.insert_or_assign(k, step).second == ref.insert_or_assign(k, step).second);
+            break;
+        case 1:
+            REQUIRE(map.erase(k) == ref.erase(k));
+            break;
+        default: {
+            auto it = map.find(k);
+            auto rit = ref.find(k);
+            REQUIRE((it == map.end()) == (rit == ref.end()));
+            if (rit != ref.end()) REQUIRE(it->second == rit->second);
+        }
+        }
+    }
+    REQUIRE(map.size() == ref.size());
+    // 反复增删同一批键不应让容量无限增长（墓碑会在原容量 rehash 时回收）
+    REQUIRE(map.capacity() <= 8191);
+    size_t n = 0;
+    for (const auto& kv : map) {
+        REQUIRE(ref.at(kv.first) == kv.second);
+        ++n;
+    }
+    REQUIRE(n == ref.size());
+
+    map.rehash(0);
+    REQUIRE(map.size() == ref.size());
+    for (const auto& kv : ref) REQUIRE(map.at(kv.first) == kv.second);
+}
+
+TEST_CASE("reserve 后插入不 rehash", "[flat_hash_map]") {
+    simple_stl::flat_hash_map<int, int> map;
+    map.reserve(1000);
+    size_t cap = map.capacity();
+    map[0] = 0;
+    const int* first = &map.at(0);
+    for (int i = 1; i < 1000; ++i) map[i] = i;
+    REQUIRE(map.capacity() == cap);
+    REQUIRE(first == &map.at(0));
+}
+
+// 透明哈希：std::string 键可以直接用 string_view / const char* 查找，不构造临时字符串
+struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const { return std::hash<std::string_view>()(s); }
+};
+struct StringEqual {
+    using is_transparent = void;
+    bool operator()(std::string_view a, std::string_view b) const { return a == b; }
+};
+
+TEST_CASE("异构查找与只能移动的值", "[flat_hash_map]") {
+    simple_stl::flat_hash_map<std::string, std::unique_ptr<int>, StringHash, StringEqual> map;
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(map.try_emplace("key" + std::to_string(i), new int(i)).second);
+    }
+    std::string_view sv = "key42";
+    REQUIRE(map.find(sv) != map.end());
+    REQUIRE(*map.find(sv)->second == 42);
+    REQUIRE(map.contains("key7"));
+    REQUIRE(map.count(std::string_view("nope")) == 0);
+    REQUIRE(map.erase(std::string_view("key7")) == 1);
+    REQUIRE(map.size() == 99);
+
+    // 键已存在时 try_emplace 不会消耗参数
+    std::unique_ptr<int> p(new int(-1));
+    REQUIRE_FALSE(map.try_emplace("key1", std::move(p)).second);
+    REQUIRE(p != nullptr);
+
+    auto moved = std::move(map);
+    REQUIRE(map.empty());
+    REQUIRE(moved.size() == 99);
+    REQUIRE(*moved.at("key99") == 99);
+}
+
+TEST_CASE("拷贝、交换与比较", "[flat_hash_map]") {
+    simple_stl::flat_hash_map<std::string, int> a{{"one", 1}, {"two", 2}, {"three", 3}};
+    simple_stl::flat_hash_map<std::string, int> b(a);
+    REQUIRE(a == b);
+    b["two"] = 22;
+    REQUIRE(a != b);
+    REQUIRE(a.at("two") == 2);
+
+    simple_stl::flat_hash_map<std::string, int> c;
+    c = a;
+    REQUIRE(c == a);
+    c.emplace("four", 4);
+    swap(a, c);
+    REQUIRE(a.size() == 4);
+    REQUIRE(c.size() == 3);
+
+    simple_stl::flat_hash_map<std::string, int>::const_iterator it = a.find("four");
+    REQUIRE(it->second == 4);
+    a.erase(it);
+    REQUIRE(a == c);
+}
@@ -0,0 +1,135 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/flat_map.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+TEST_CASE("无分支二分与 std::lower_bound 一致", "[flat_map]") {
+    std::vector<int> v = {1, 3, 3, 5, 7, 9, 11};
+    auto less = [](int a, int b) { return a < b; };
+    for (int k = 0; k <= 12; ++k) {
+        auto it = simple_stl::flat_detail::branchless_lower_bound(v.begin(), v.size(), k, less);
+        REQUIRE(it == std::lower_bound(v.begin(), v.end(), k));
+    }
+    REQUIRE(simple_stl::flat_detail::branchless_lower_bound(v.begin(), 0, 5, less) == v.begin());
+}
+
+TEST_CASE("flat_map 基本操作", "[flat_map]") {
+    simple_stl::flat_map<std::string, int> map{{"b", 2}, {"a", 1}, {"c", 3}, {"a", 100}};
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.at("a") == 1); // 重复键保留先出现的
+    REQUIRE_THROWS_AS(map.at("z"), std::out_of_range);
+
+    // 遍历按键有序
+    std::string keys;
+    for (const auto& kv : map) keys += kv.first;
+    REQUIRE(keys == "abc");
+
+    REQUIRE(map.insert({"d", 4}).second);
+    REQUIRE_FALSE(map.insert({"d", 40}).second);
+    REQUIRE(map.try_emplace("e", 5).second);
+    REQUIRE(map.insert_or_assign("e", 50).second == false);
+    REQUIRE(map["e"] == 50);
+    map["0"] = -1;
+    REQUIRE(map.begin()->first == "0");
+    REQUIRE(map.rbegin()->first == "e");
+
+    REQUIRE(map.lower_bound("bb")->first == "c");
+    REQUIRE(map.upper_bound("c")->first == "d");
+    REQUIRE(map.find("x") == map.end());
+    REQUIRE(map.count("c") == 1);
+
+    REQUIRE(map.erase("c") == 1);
+    REQUIRE(map.erase("c") == 0);
+    auto it = map.erase(map.find("a"));
+    REQUIRE(it->first == "b");
+    REQUIRE(map.size() == 4);
+
+    simple_stl::flat_map<std::string, int> copy(map);
+    REQUIRE(copy == map);
+    copy["b"] = 0;
+    REQUIRE(copy != map);
+}
+
+TEST_CASE("批量插入只做一次归并", "[flat_map]") {
+    simple_stl::flat_map<int, int> map;
+    for (int i = 0; i < 100; i += 2) map[i] = i;
+
+    // 乱序输入：内部先排序再归并
+    std::vector<std::pair<int, int>> batch;
+    for (int i = 199; i >= 1; i -= 2) batch.push_back({i, i});
+    batch.push_back({50, -1}); // 已存在的键不覆盖
+    map.insert(batch.begin(), batch.end());
+    REQUIRE(map.size() == 150);
+    REQUIRE(map.at(50) == 50);
+    REQUIRE(std::is_sorted(map.begin(), map.end()));
+
+    // 已有序输入：跳过排序
+    std::vector<std::pair<int, int>> sorted;
+    for (int i = 200; i < 300; ++i) sorted.push_back({i, i});
+    map.insert(simple_stl::sorted_unique, sorted.begin(), sorted.end());
+    REQUIRE(map.size() == 250);
+    REQUIRE(map.rbegin()->first == 299);
+}
+
+TEST_CASE("flat_set 与 std::set 随机对拍", "[flat_set]") {
+    simple_stl::flat_set<int> set;
+    simple_stl::flat_set<int, std::less<int>, simple_stl::eytzinger_layout> eset;
+    std::set<int> ref;
+    std::mt19937 rng(7);
+    for (int step = 0; step < 5000; ++step) {
+        int k = static_cast<int>(rng() % 1000);
+        if (rng() % 3) {
+            bool inserted = ref.insert(k).second;
+            REQUIRE(set.insert(k).second == inserted);
+            REQUIRE(eset.insert(k).second == inserted);
+        } else {
+            size_t erased = ref.erase(k);
+            REQUIRE(set.erase(k) == erased);
+            REQUIRE(eset.erase(k) == erased);
+        }
+        int q = static_cast<int>(rng() % 1001);
+        auto rit = ref.lower_bound(q);
+        auto it = set.lower_bound(q);
+        auto eit = eset.lower_bound(q);
+        REQUIRE((rit == ref.end()) == (it == set.end()));
+        REQUIRE((rit == ref.end()) == (eit == eset.end()));
+        if (rit != ref.end()) {
+            REQUIRE(*it == *rit);
+            REQUIRE(*eit == *rit);
+        }
+    }
+    REQUIRE(std::equal(set.begin(), set.end(), ref.begin(), ref.end()));
+    REQUIRE(std::equal(eset.begin(), eset.end(), ref.begin(), ref.end()));
+    static_assert(std::is_same<decltype(*set.begin()), const int&>::value, "flat_set 元素不可修改");
+}
+
+TEST_CASE("Eytzinger 布局的 flat_map", "[flat_map]") {
+    std::vector<std::pair<int, std::string>> src;
+    for (int i = 0; i < 1000; ++i) src.push_back({i * 3, std::to_string(i)});
+    simple_stl::flat_map<int, std::string, std::less<int>, simple_stl::eytzinger_layout> map(
+        simple_stl::sorted_unique, src.begin(), src.end());
+    for (int k = -1; k <= 3000; ++k) {
+        auto it = map.find(k);
+        if (k >= 0 && k < 3000 && k % 3 == 0) {
+            REQUIRE(it != map.end());
+            REQUIRE(it->second == std::to_string(k / 3));
+        } else {
+            REQUIRE(it == map.end());
+        }
+    }
+    map.clear();
+    REQUIRE(map.find(0) == map.end());
+}
+
+// 透明比较器：std::string 键可以直接用 const char* 查找
+TEST_CASE("异构查找", "[flat_map]") {
+    simple_stl::flat_map<std::string, int, std::less<>> map{{"apple", 1}, {"pear", 2}};
+    REQUIRE(map.find("pear")->second == 2);
+    REQUIRE(map.contains("apple"));
+    REQUIRE_FALSE(map.contains("kiwi"));
+}
@@ -0,0 +1,106 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "common/hazard_pointer.h"
+#include "common/allocator.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+struct Config {
+    static std::atomic<int> alive;
+    int version;
+    int doubled;
+    explicit Config(int v) : version(v), doubled(v * 2) { ++alive; }
+    ~Config() { --alive; }
+};
+std::atomic<int> Config::alive{0};
+
+TEST_CASE("被保护的对象不会被释放", "[hazard_pointer]") {
+    simple_stl::hazard_domain domain(4);
+    std::atomic<Config*> current{new Config(0)};
+    {
+        simple_stl::hazptr_holder holder(domain);
+        Config* seen = holder.protect(current);
+        REQUIRE(seen->version == 0);
+
+        // 写者替换并退休旧对象
+        domain.retire(current.exchange(new Config(1)));
+        REQUIRE(domain.reclaim() == 0);
+        REQUIRE(domain.pending() == 1);
+        REQUIRE(seen->version == 0);
+
+        holder.reset_protection();
+        REQUIRE(domain.reclaim() == 1);
+        REQUIRE(domain.pending() == 0);
+        REQUIRE(domain.slot_count() == 1);
+    }
+    // 归还的槽位被复用
+    { simple_stl::hazptr_holder again(domain); }
+    REQUIRE(domain.slot_count() == 1);
+    domain.retire(current.exchange(nullptr));
+    domain.reclaim();
+    REQUIRE(Config::alive == 0);
+}
+
+TEST_CASE("读者停顿时未回收内存有界", "[hazard_pointer]") {
+    simple_stl::hazard_domain domain(16);
+    std::atomic<Config*> current{new Config(0)};
+    simple_stl::hazptr_holder stalled(domain);
+    Config* pinned = stalled.protect(current);
+    size_t max_pending = 0;
+    for (int v = 1; v <= 10000; ++v) {
+        domain.retire(current.exchange(new Config(v)));
+        max_pending = std::max(max_pending, domain.pending());
+    }
+    // 只有被登记的那一个对象一直保留，其余按批释放
+    REQUIRE(max_pending <= 16);
+    REQUIRE(Config::alive <= 17);
+    REQUIRE(pinned->version == 0);
+    stalled.reset_protection();
+    domain.reclaim();
+    REQUIRE(Config::alive == 1);
+    delete current.load();
+}
+
+TEST_CASE("读者并发读取，写者并发发布", "[hazard_pointer]") {
+    {
+        simple_stl::hazard_domain domain;
+        std::atomic<Config*> current{new Config(0)};
+        std::atomic<bool> stop{false};
+        std::atomic<long> torn{0};
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 6; ++r) {
+            readers.emplace_back([&] {
+                simple_stl::hazptr_holder holder(domain);
+                while (!stop.load(std::memory_order_relaxed)) {
+                    Config* c = holder.protect(current);
+                    if (c->doubled != c->version * 2) ++torn;
+                    holder.reset_protection();
+                }
+            });
+        }
+        std::vector<std::thread> writers;
+        for (int w = 0; w < 2; ++w) {
+            writers.emplace_back([&, w] {
+                for (int v = 1; v <= 10000; ++v) domain.retire(current.exchange(new Config(w * 10000 + v)));
+            });
+        }
+        for (auto& t : writers) t.join();
+        stop = true;
+        for (auto& t : readers) t.join();
+        REQUIRE(torn == 0);
+        REQUIRE(domain.slot_count() >= 6);
+        domain.retire(current.exchange(nullptr));
+    }
+    // domain 析构释放剩余的退休对象
+    REQUIRE(Config::alive == 0);
+}
+
+TEST_CASE("通过分配器回收节点", "[hazard_pointer]") {
+    simple_stl::hazard_domain domain(1);
+    simple_stl::allocator<Config> alloc;
+    Config* c = alloc.allocate(1);
+    alloc.construct(c, 5);
+    domain.retire(c, alloc);
+    REQUIRE(Config::alive == 0);
+}
@@ -0,0 +1,101 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/intrusive_list.h"
+#include <vector>
+
+// 模拟定时器条目：同一个对象可以同时挂在两条链表上
+struct TimerEntry {
+    int id;
+    simple_stl::intrusive_list_hook wheel_hook;
+    simple_stl::intrusive_list_hook expire_hook;
+    explicit TimerEntry(int i) : id(i) {}
+};
+
+using WheelList = simple_stl::intrusive_list<TimerEntry, &TimerEntry::wheel_hook>;
+using ExpireList = simple_stl::intrusive_list<TimerEntry, &TimerEntry::expire_hook>;
+
+static std::vector<int> ids(const WheelList& list) {
+    std::vector<int> out;
+    for (const TimerEntry& e : list) {
+        out.push_back(e.id);
+    }
+    return out;
+}
+
+TEST_CASE("侵入式链表基本操作", "[intrusive_list]") {
+    TimerEntry a(1), b(2), c(3), d(4);
+    WheelList list;
+    REQUIRE(list.empty());
+
+    list.push_back(b);
+    list.push_front(a);
+    list.push_back(d);
+    list.insert(list.iterator_to(d), c);
+    REQUIRE(list.size() == 4);
+    REQUIRE(ids(list) == std::vector<int>{1, 2, 3, 4});
+    REQUIRE(&list.front() == &a); // 链表中就是元素本身，没有拷贝
+    REQUIRE(&list.back() == &d);
+    REQUIRE(a.wheel_hook.is_linked());
+    REQUIRE_FALSE(a.expire_hook.is_linked());
+
+    SECTION("凭元素本身 O(1) 摘下") {
+        list.erase(c);
+        REQUIRE_FALSE(c.wheel_hook.is_linked());
+        REQUIRE(ids(list) == std::vector<int>{1, 2, 4});
+        // 摘下后可以重新插入
+        list.push_front(c);
+        REQUIRE(ids(list) == std::vector<int>{3, 1, 2, 4});
+    }
+
+    SECTION("迭代器删除与反向遍历") {
+        auto it = list.erase(list.begin());
+        REQUIRE(it->id == 2);
+        list.pop_back();
+        REQUIRE(ids(list) == std::vector<int>{2, 3});
+        REQUIRE((--list.end())->id == 3);
+        REQUIRE_FALSE(a.wheel_hook.is_linked());
+        REQUIRE_FALSE(d.wheel_hook.is_linked());
+    }
+
+    SECTION("同时挂在两条链表") {
+        ExpireList expired;
+        expired.push_back(c);
+        expired.push_back(a);
+        REQUIRE(expired.size() == 2);
+        REQUIRE(expired.front().id == 3);
+        list.erase(c);
+        REQUIRE(expired.front().id == 3); // 不影响另一条链表
+        expired.clear();
+        REQUIRE_FALSE(c.expire_hook.is_linked());
+    }
+
+    SECTION("splice 与 move") {
+        TimerEntry e(5), f(6);
+        WheelList other;
+        other.push_back(e);
+        other.push_back(f);
+        list.splice(list.begin(), other);
+        REQUIRE(other.empty());
+        REQUIRE(ids(list) == std::vector<int>{5, 6, 1, 2, 3, 4});
+
+        WheelList moved(std::move(list));
+        REQUIRE(list.empty());
+        REQUIRE(moved.size() == 6);
+        REQUIRE((--moved.end())->id == 4);
+        moved.clear();
+        REQUIRE_FALSE(e.wheel_hook.is_linked());
+    }
+
+    list.clear(); // 元素先于链表析构之前必须摘下
+}
+
+TEST_CASE("拷贝元素不拷贝链接关系", "[intrusive_list]") {
+    TimerEntry a(1);
+    WheelList list;
+    list.push_back(a);
+    TimerEntry copy(a);
+    REQUIRE_FALSE(copy.wheel_hook.is_linked());
+    list.push_back(copy);
+    REQUIRE(list.size() == 2);
+    list.clear();
+}
@@ -0,0 +1,87 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "common/intrusive_ptr.h"
+#include <thread>
+#include <vector>
+
+struct Counted : simple_stl::intrusive_ref_counter<Counted> {
+    static int alive;
+    int value;
+    explicit Counted(int v) : value(v) { ++alive; }
+    Counted(const Counted& other) : intrusive_ref_counter(other), value(other.value) { ++alive; }
+    ~Counted() { --alive; }
+    // 在成员函数里直接由 this 得到一个新的所有者
+    simple_stl::intrusive_ptr<Counted> self() { return simple_stl::intrusive_ptr<Counted>(this); }
+};
+int Counted::alive = 0;
+
+TEST_CASE("intrusive_ptr 计数与 this 转换", "[intrusive_ptr]") {
+    static_assert(sizeof(simple_stl::intrusive_ptr<Counted>) == sizeof(Counted*), "");
+    {
+        auto p = simple_stl::make_intrusive<Counted>(5);
+        REQUIRE(p->use_count() == 1);
+        auto q = p->self();
+        REQUIRE(q == p);
+        REQUIRE(p->use_count() == 2);
+        simple_stl::intrusive_ptr<const Counted> c = q;
+        REQUIRE(p->use_count() == 3);
+        REQUIRE(simple_stl::const_pointer_cast<Counted>(c) == p);
+        q.reset();
+        c = nullptr;
+        REQUIRE(p->use_count() == 1);
+
+        // 拷贝对象不拷贝计数
+        auto copy = simple_stl::make_intrusive<Counted>(*p);
+        REQUIRE(copy->use_count() == 1);
+        REQUIRE(Counted::alive == 2);
+    }
+    REQUIRE(Counted::alive == 0);
+}
+
+TEST_CASE("detach 与不加计数的接管", "[intrusive_ptr]") {
+    auto p = simple_stl::make_intrusive<Counted>(1);
+    Counted* raw = p.detach();
+    REQUIRE(!p);
+    REQUIRE(raw->use_count() == 1);
+    simple_stl::intrusive_ptr<Counted> back(raw, false);
+    REQUIRE(back->use_count() == 1);
+    back.reset(new Counted(2));
+    REQUIRE(Counted::alive == 1);
+    back = simple_stl::intrusive_ptr<Counted>();
+    REQUIRE(Counted::alive == 0);
+}
+
+struct Shape : simple_stl::intrusive_ref_counter<Shape, simple_stl::local_refcount> {
+    virtual ~Shape() = default;
+    virtual int sides() const { return 0; }
+};
+struct Square : Shape {
+    int sides() const override { return 4; }
+};
+
+TEST_CASE("非原子计数与类型转换", "[intrusive_ptr]") {
+    simple_stl::intrusive_ptr<Shape> s = simple_stl::make_intrusive<Square>();
+    REQUIRE(s->sides() == 4);
+    auto sq = simple_stl::dynamic_pointer_cast<Square>(s);
+    REQUIRE(sq);
+    REQUIRE(s->use_count() == 2);
+    REQUIRE(!simple_stl::dynamic_pointer_cast<Square>(simple_stl::make_intrusive<Shape>()));
+    simple_stl::intrusive_ptr<Shape> moved = std::move(sq);
+    REQUIRE(sq == nullptr);
+    REQUIRE(s->use_count() == 2);
+}
+
+TEST_CASE("多线程拷贝", "[intrusive_ptr]") {
+    auto p = simple_stl::make_intrusive<Counted>(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([p] {
+            for (int i = 0; i < 20000; ++i) {
+                auto copy = p;
+                (void)copy;
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    REQUIRE(p->use_count() == 1);
+}
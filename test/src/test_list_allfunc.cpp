@@ -2,6 +2,13 @@
 #include "catch_amalgamated.hpp" 
 #include "containers/list.h"
 #include <vector>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <functional>
+#include <stdexcept>
+#include <string>
 
 TEST_CASE("默认构造函数测试", "[List][constructor]") {
     simple_stl::List<int> list;  
@@ -53,4 +60,268 @@ TEST_CASE("拷贝构造函数测试", "[List][constructor]") {
         ++copy_it;
     }
     REQUIRE(copy_it == copy.end());  
-}
\ No newline at end of file
+}
+
+TEST_CASE("头尾插入删除与size", "[List][modifiers]") {
+    simple_stl::List<int> list;
+    REQUIRE(list.empty());
+    list.push_back(2);
+    list.push_front(1);
+    list.emplace_back(3);
+    list.emplace_front(0);
+    REQUIRE(list.size() == 4);
+    REQUIRE(list.front() == 0);
+    REQUIRE(list.back() == 3);
+
+    list.pop_front();
+    list.pop_back();
+    REQUIRE(list == simple_stl::List<int>{1, 2});
+
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+    REQUIRE_THROWS_AS(list.pop_back(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.pop_front(), std::out_of_range);
+}
+
+TEST_CASE("insert 与 erase", "[List][modifiers]") {
+    simple_stl::List<int> list{1, 4};
+    auto it = list.begin();
+    ++it;
+    auto pos = list.insert(it, 3);
+    REQUIRE(*pos == 3);
+    list.insert(pos, 2);
+    REQUIRE(list == simple_stl::List<int>{1, 2, 3, 4});
+
+    list.insert(list.end(), 2, 9);
+    REQUIRE(list == simple_stl::List<int>{1, 2, 3, 4, 9, 9});
+
+    std::vector<int> extra = {7, 8};
+    auto first_new = list.insert(list.begin(), extra.begin(), extra.end());
+    REQUIRE(*first_new == 7);
+    REQUIRE(list.size() == 8);
+
+    auto next = list.erase(list.begin());
+    REQUIRE(*next == 8);
+    auto last = list.begin();
+    ++last; ++last;
+    list.erase(list.begin(), last);
+    REQUIRE(list == simple_stl::List<int>{2, 3, 4, 9, 9});
+}
+
+TEST_CASE("splice 只重链接节点", "[List][splice]") {
+    simple_stl::List<int> a{1, 2, 3};
+    simple_stl::List<int> b{10, 20, 30};
+    int* addr20 = &*(++b.begin());
+
+    SECTION("整表拼接") {
+        a.splice(a.end(), b);
+        REQUIRE(a == simple_stl::List<int>{1, 2, 3, 10, 20, 30});
+        REQUIRE(b.empty());
+        REQUIRE(&*(++++++++a.begin()) == addr20); // 元素地址不变
+    }
+
+    SECTION("单个节点") {
+        a.splice(a.begin(), b, ++b.begin());
+        REQUIRE(a == simple_stl::List<int>{20, 1, 2, 3});
+        REQUIRE(b == simple_stl::List<int>{10, 30});
+        REQUIRE(&a.front() == addr20);
+    }
+
+    SECTION("区间") {
+        a.splice(++a.begin(), b, b.begin(), --b.end());
+        REQUIRE(a == simple_stl::List<int>{1, 10, 20, 2, 3});
+        REQUIRE(b == simple_stl::List<int>{30});
+        REQUIRE(a.size() == 5);
+        REQUIRE(b.size() == 1);
+    }
+
+    SECTION("同一链表内移动") {
+        a.splice(a.begin(), a, --a.end());
+        REQUIRE(a == simple_stl::List<int>{3, 1, 2});
+        a.splice(a.end(), a, a.begin(), ++a.begin());
+        REQUIRE(a == simple_stl::List<int>{1, 2, 3});
+        REQUIRE(a.size() == 3);
+    }
+}
+
+TEST_CASE("merge 与 sort", "[List][sort]") {
+    simple_stl::List<int> a{1, 3, 5, 7};
+    simple_stl::List<int> b{2, 3, 6};
+    a.merge(b);
+    REQUIRE(a == simple_stl::List<int>{1, 2, 3, 3, 5, 6, 7});
+    REQUIRE(a.size() == 7);
+    REQUIRE(b.empty());
+
+    simple_stl::List<int> c{5, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    c.sort();
+    REQUIRE(c == simple_stl::List<int>{1, 1, 2, 3, 4, 5, 5, 5, 5, 6, 9});
+    c.sort(std::greater<int>());
+    REQUIRE(c.front() == 9);
+    REQUIRE(c.back() == 1);
+    // 反向遍历验证 prev 指针已恢复
+    REQUIRE(*(--c.end()) == 1);
+    REQUIRE(*(----c.end()) == 1);
+
+    SECTION("稳定性") {
+        using P = std::pair<int, int>;
+        simple_stl::List<P> list;
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(P((i * 7919) % 13, i));
+        }
+        list.sort([](const P& x, const P& y) { return x.first < y.first; });
+        auto prev = list.begin();
+        for (auto it = ++list.begin(); it != list.end(); ++it, ++prev) {
+            REQUIRE(prev->first <= it->first);
+            if (prev->first == it->first) {
+                REQUIRE(prev->second < it->second);
+            }
+        }
+        REQUIRE(list.size() == 1000);
+    }
+}
+
+TEST_CASE("remove_if / unique / reverse", "[List][operations]") {
+    simple_stl::List<int> list{1, 1, 2, 3, 3, 3, 4, 1};
+    REQUIRE(list.unique() == 3);
+    REQUIRE(list == simple_stl::List<int>{1, 2, 3, 4, 1});
+    REQUIRE(list.remove(1) == 2);
+    REQUIRE(list.remove_if([](int x) { return x % 2 == 0; }) == 2);
+    REQUIRE(list == simple_stl::List<int>{3});
+
+    simple_stl::List<int> r{1, 2, 3, 4};
+    r.reverse();
+    REQUIRE(r == simple_stl::List<int>{4, 3, 2, 1});
+
+    // remove 的参数引用了链表中的元素
+    simple_stl::List<int> self{5, 6, 5};
+    self.remove(self.front());
+    REQUIRE(self == simple_stl::List<int>{6});
+}
+
+TEST_CASE("move-only 元素", "[List][move]") {
+    simple_stl::List<std::unique_ptr<int>> list;
+    list.push_back(std::make_unique<int>(1));
+    list.emplace_back(new int(2));
+    list.emplace_front(std::make_unique<int>(0));
+    REQUIRE(**list.begin() == 0);
+    REQUIRE(*list.back() == 2);
+
+    simple_stl::List<std::unique_ptr<int>> other(std::move(list));
+    REQUIRE(list.empty());
+    REQUIRE(other.size() == 3);
+    other.sort([](const std::unique_ptr<int>& x, const std::unique_ptr<int>& y) { return *x > *y; });
+    REQUIRE(*other.front() == 2);
+}
+
+// 统计拷贝/移动次数，且没有默认构造函数
+struct Tracked {
+    static int copies;
+    static int moves;
+    int a;
+    std::string b;
+    Tracked(int x, std::string y) : a(x), b(std::move(y)) {}
+    Tracked(const Tracked& o) : a(o.a), b(o.b) { ++copies; }
+    Tracked(Tracked&& o) noexcept : a(o.a), b(std::move(o.b)) { ++moves; }
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+TEST_CASE("节点原地构造与无数据哨兵", "[List][emplace]") {
+    Tracked::copies = 0;
+    Tracked::moves = 0;
+
+    // Tracked 没有默认构造函数，哨兵不再需要构造T
+    simple_stl::List<Tracked> list;
+    list.emplace_back(1, "one");
+    list.emplace_front(0, "zero");
+    list.emplace(list.end(), 2, "two");
+    REQUIRE(Tracked::copies == 0);
+    REQUIRE(Tracked::moves == 0);
+
+    list.push_back(Tracked(3, "three"));
+    REQUIRE(Tracked::copies == 0);
+    REQUIRE(Tracked::moves == 1);
+
+    // splice/sort 只改指针
+    list.sort([](const Tracked& x, const Tracked& y) { return x.a > y.a; });
+    REQUIRE(list.front().b == "three");
+    REQUIRE(Tracked::copies == 0);
+    REQUIRE(Tracked::moves == 1);
+
+    SECTION("swap/移动后哨兵指针正确") {
+        simple_stl::List<Tracked> other;
+        other.swap(list);
+        REQUIRE(list.empty());
+        REQUIRE(list.begin() == list.end());
+        REQUIRE(other.size() == 4);
+        REQUIRE((--other.end())->a == 0);
+
+        simple_stl::List<Tracked> moved(std::move(other));
+        REQUIRE(other.empty());
+        REQUIRE(moved.back().b == "zero");
+        moved.emplace_back(-1, "tail");
+        REQUIRE(moved.size() == 5);
+        REQUIRE(Tracked::copies == 0);
+    }
+}
+
+// 统计分配次数的自定义分配器（模拟内存池）
+static int g_pool_allocs = 0;
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    template <typename U>
+    struct rebind { typedef CountingAllocator<U> other; };
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(size_t n) {
+        ++g_pool_allocs;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T* p, size_t) { ::operator delete(p); }
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) { ::new ((void*)p) U(std::forward<Args>(args)...); }
+    template <typename U>
+    void destroy(U* p) { p->~U(); }
+};
+
+TEST_CASE("自定义分配器、常量与反向迭代器", "[List][iterator]") {
+    g_pool_allocs = 0;
+    simple_stl::List<int, CountingAllocator<int>> list{3, 1, 2};
+    REQUIRE(g_pool_allocs == 3); // 哨兵不占分配
+    int sum = 0;
+    for (int v : list) sum += v;
+    REQUIRE(sum == 6);
+
+    // 常量迭代器只读；普通迭代器可以隐式转换为常量迭代器
+    const auto& clist = list;
+    simple_stl::List<int, CountingAllocator<int>>::const_iterator cit = list.begin();
+    REQUIRE(cit == clist.cbegin());
+    REQUIRE(list.begin() == cit);
+    static_assert(std::is_same<decltype(*cit), const int&>::value, "const_iterator 解引用应为 const T&");
+    static_assert(!std::is_convertible<simple_stl::List<int>::const_iterator, simple_stl::List<int>::iterator>::value,
+                  "常量迭代器不能转换为普通迭代器");
+
+    std::vector<int> rev(list.rbegin(), list.rend());
+    REQUIRE(rev == std::vector<int>{2, 1, 3});
+    std::vector<int> crev(clist.crbegin(), clist.crend());
+    REQUIRE(crev == rev);
+
+    // 标准算法
+    REQUIRE(std::distance(list.begin(), list.end()) == 3);
+    REQUIRE(*std::find(list.begin(), list.end(), 1) == 1);
+    std::reverse(list.begin(), list.end());
+    REQUIRE(list == simple_stl::List<int, CountingAllocator<int>>{2, 1, 3});
+    list.sort();
+    REQUIRE(*list.rbegin() == 3);
+    list.erase(list.cbegin());
+    REQUIRE(list.front() == 2);
+
+#if __cplusplus >= 202002L
+    static_assert(std::bidirectional_iterator<simple_stl::List<int>::iterator>);
+    static_assert(std::bidirectional_iterator<simple_stl::List<int>::const_iterator>);
+    static_assert(std::bidirectional_iterator<simple_stl::List<int>::reverse_iterator>);
+#endif
+}
@@ -0,0 +1,122 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/priority_queue.h"
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("d 叉堆与 std::priority_queue 对拍", "[priority_queue]") {
+    simple_stl::priority_queue<int> heap4;
+    simple_stl::priority_queue<int, std::less<int>, 2> heap2;
+    simple_stl::priority_queue<int, std::less<int>, 8> heap8;
+    std::priority_queue<int> ref;
+    std::mt19937 rng(9);
+    for (int step = 0; step < 50000; ++step) {
+        if (ref.empty() || rng() % 3) {
+            int v = static_cast<int>(rng() % 1000);
+            heap4.push(v);
+            heap2.push(v);
+            heap8.push(v);
+            ref.push(v);
+        } else {
+            REQUIRE(heap4.top() == ref.top());
+            REQUIRE(heap2.top() == ref.top());
+            REQUIRE(heap8.top() == ref.top());
+            heap4.pop();
+            heap2.pop();
+            heap8.pop();
+            ref.pop();
+        }
+        REQUIRE(heap4.size() == ref.size());
+    }
+}
+
+TEST_CASE("建堆、小顶堆与 top-K", "[priority_queue]") {
+    std::vector<int> data(1000);
+    std::mt19937 rng(1);
+    for (int& v : data) v = static_cast<int>(rng() % 100000);
+
+    simple_stl::priority_queue<int, std::greater<int>> min_heap(data.begin(), data.end());
+    std::vector<int> drained;
+    while (!min_heap.empty()) drained.push_back(min_heap.take_top());
+    std::vector<int> sorted = data;
+    std::sort(sorted.begin(), sorted.end());
+    REQUIRE(drained == sorted);
+
+    // 用大小为 K 的小顶堆求最大的 K 个数
+    const std::size_t K = 10;
+    simple_stl::priority_queue<int, std::greater<int>> topk;
+    for (int v : data) {
+        if (topk.size() < K) topk.push(v);
+        else if (v > topk.top()) topk.replace_top(v);
+    }
+    std::vector<int> got;
+    while (!topk.empty()) got.push_back(topk.take_top());
+    REQUIRE(got == std::vector<int>(sorted.end() - K, sorted.end()));
+
+    REQUIRE_THROWS_AS(topk.pop(), std::out_of_range);
+    REQUIRE_THROWS_AS(topk.top(), std::out_of_range);
+}
+
+TEST_CASE("可索引堆：通过句柄修改优先级与删除", "[priority_queue]") {
+    using Heap = simple_stl::indexed_priority_queue<int, std::greater<int>>;
+    Heap heap;
+    std::map<Heap::handle, int> live; // 句柄 -> 当前值
+    std::mt19937 rng(21);
+    for (int step = 0; step < 30000; ++step) {
+        unsigned op = rng() % 5;
+        if (live.empty() || op < 2) {
+            int v = static_cast<int>(rng() % 10000);
+            Heap::handle h = heap.push(v);
+            REQUIRE(live.count(h) == 0);
+            live[h] = v;
+        } else {
+            auto it = live.begin();
+            std::advance(it, rng() % live.size());
+            if (op == 2) {
+                // decrease-key 与 increase-key 都要支持
+                int v = static_cast<int>(rng() % 10000);
+                heap.update(it->first, v);
+                it->second = v;
+            } else if (op == 3) {
+                heap.erase(it->first);
+                REQUIRE(!heap.contains(it->first));
+                live.erase(it);
+            } else {
+                int expect = std::min_element(live.begin(), live.end(), [](const auto& a, const auto& b) {
+                    return a.second < b.second;
+                })->second;
+                REQUIRE(heap.top() == expect);
+                REQUIRE(live[heap.top_handle()] == expect);
+                live.erase(heap.top_handle());
+                heap.pop();
+            }
+        }
+        REQUIRE(heap.size() == live.size());
+        if (step % 1000 == 0) {
+            for (const auto& kv : live) REQUIRE(heap.value(kv.first) == kv.second);
+        }
+    }
+    REQUIRE_THROWS_AS(heap.erase(Heap::npos), std::out_of_range);
+}
+
+TEST_CASE("可索引堆存放非平凡类型", "[priority_queue]") {
+    simple_stl::indexed_priority_queue<std::string> heap;
+    auto a = heap.push("apple");
+    auto b = heap.push("banana");
+    heap.push("cherry");
+    REQUIRE(heap.top() == "cherry");
+    heap.update(a, "zucchini");
+    REQUIRE(heap.top_handle() == a);
+    heap.erase(a);
+    REQUIRE(heap.take_top() == "cherry");
+    REQUIRE(heap.top_handle() == b);
+    // 删除后句柄会被复用
+    auto c = heap.push("date");
+    REQUIRE(heap.contains(c));
+    REQUIRE(heap.top() == "date");
+}
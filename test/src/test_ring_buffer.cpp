@@ -0,0 +1,110 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/ring_buffer.h"
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using simple_stl::overflow_policy;
+using simple_stl::ring_buffer;
+
+TEST_CASE("容量取整到2的幂", "[ring_buffer]") {
+    REQUIRE(ring_buffer<int>(1).capacity() == 1);
+    REQUIRE(ring_buffer<int>(5).capacity() == 8);
+    REQUIRE(ring_buffer<int>(64).capacity() == 64);
+    REQUIRE(ring_buffer<int>(65).capacity() == 128);
+    REQUIRE_THROWS_AS(ring_buffer<int>(0), std::invalid_argument);
+}
+
+TEST_CASE("reject 模式与 std::deque 对拍", "[ring_buffer]") {
+    ring_buffer<int> rb(16);
+    std::deque<int> ref;
+    std::mt19937 rng(3);
+    for (int step = 0; step < 20000; ++step) {
+        if (rng() % 2) {
+            bool ok = rb.push_back(step);
+            REQUIRE(ok == (ref.size() < 16));
+            if (ok) ref.push_back(step);
+        } else {
+            int out = -1;
+            bool ok = rb.try_pop(out);
+            REQUIRE(ok == !ref.empty());
+            if (ok) {
+                REQUIRE(out == ref.front());
+                ref.pop_front();
+            }
+        }
+        REQUIRE(rb.size() == ref.size());
+        REQUIRE(rb.full() == (ref.size() == 16));
+        REQUIRE(std::equal(rb.begin(), rb.end(), ref.begin(), ref.end()));
+    }
+    rb.clear();
+    REQUIRE(rb.empty());
+    REQUIRE_THROWS_AS(rb.pop_front(), std::out_of_range);
+}
+
+TEST_CASE("overwrite 模式保留最近的样本", "[ring_buffer]") {
+    ring_buffer<int> window(8, overflow_policy::overwrite);
+    for (int i = 0; i < 100; ++i) REQUIRE(window.push_back(i));
+    REQUIRE(window.full());
+    REQUIRE(window.front() == 92);
+    REQUIRE(window.back() == 99);
+    REQUIRE(window[3] == 95);
+    REQUIRE(std::accumulate(window.begin(), window.end(), 0) == 92 + 93 + 94 + 95 + 96 + 97 + 98 + 99);
+    std::vector<int> reversed(window.rbegin(), window.rend());
+    REQUIRE(reversed.front() == 99);
+    REQUIRE(reversed.back() == 92);
+    REQUIRE(*std::max_element(window.cbegin(), window.cend()) == 99);
+}
+
+TEST_CASE("批量读写跨越数组末尾", "[ring_buffer]") {
+    ring_buffer<int> rb(8);
+    std::vector<int> src(20);
+    std::iota(src.begin(), src.end(), 0);
+
+    REQUIRE(rb.push(src.data(), 5) == 5);
+    int out[8] = {};
+    REQUIRE(rb.pop(out, 3) == 3);
+    REQUIRE((out[0] == 0 && out[1] == 1 && out[2] == 2));
+    // 此时 head 在槽位3，写入7个会绕回数组开头，但只剩6个空位
+    REQUIRE(rb.push(src.data() + 5, 7) == 6);
+    REQUIRE(rb.full());
+    REQUIRE(rb.pop(out, 100) == 8);
+    for (int i = 0; i < 8; ++i) REQUIRE(out[i] == i + 3);
+    REQUIRE(rb.empty());
+
+    ring_buffer<int> window(8, overflow_policy::overwrite);
+    window.push(src.data(), 6);
+    REQUIRE(window.push(src.data() + 6, 4) == 4);
+    REQUIRE(window.front() == 2);
+    // 一次写入超过容量，只保留最后8个
+    REQUIRE(window.push(src.data(), 20) == 20);
+    REQUIRE(window.front() == 12);
+    REQUIRE(window.back() == 19);
+}
+
+TEST_CASE("非平凡类型的构造与析构", "[ring_buffer]") {
+    ring_buffer<std::string> rb(4, overflow_policy::overwrite);
+    for (int i = 0; i < 10; ++i) rb.emplace_back(std::string(32, static_cast<char>('a' + i)));
+    REQUIRE(rb.front() == std::string(32, 'g'));
+
+    ring_buffer<std::string> copy(rb);
+    REQUIRE(std::equal(copy.begin(), copy.end(), rb.begin(), rb.end()));
+    ring_buffer<std::string> moved(std::move(copy));
+    REQUIRE(moved.size() == 4);
+    REQUIRE(moved.at(3) == std::string(32, 'j'));
+    REQUIRE_THROWS_AS(moved.at(4), std::out_of_range);
+
+    ring_buffer<std::string> assigned(2);
+    assigned = moved;
+    REQUIRE(assigned.capacity() == 4);
+    REQUIRE(assigned.policy() == overflow_policy::overwrite);
+
+    std::string out[4];
+    REQUIRE(assigned.pop(out, 4) == 4);
+    REQUIRE(out[0] == std::string(32, 'g'));
+    REQUIRE(assigned.empty());
+}
@@ -0,0 +1,281 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "common/shared_ptr.h"
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int g_allocs = 0;
+static int g_deallocs = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    template <typename U>
+    struct rebind { typedef CountingAllocator<U> other; };
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(size_t n) {
+        ++g_allocs;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T* p, size_t) {
+        ++g_deallocs;
+        ::operator delete(p);
+    }
+};
+
+// 记录构造/析构次数
+struct Tracked {
+    static int alive;
+    int value;
+    explicit Tracked(int v) : value(v) { ++alive; }
+    ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+struct Throwing {
+    Throwing() { throw std::runtime_error("ctor"); }
+};
+
+TEST_CASE("make_shared 构造对象并计数", "[shared_ptr]") {
+    {
+        auto p = simple_stl::make_shared<Tracked>(7);
+        REQUIRE(Tracked::alive == 1);
+        REQUIRE(p->value == 7);
+        REQUIRE(p.use_count() == 1);
+        auto q = p;
+        REQUIRE(p.use_count() == 2);
+        REQUIRE(q == p);
+        q.reset();
+        REQUIRE(q == nullptr);
+        REQUIRE(!q);
+        REQUIRE(p.use_count() == 1);
+    }
+    REQUIRE(Tracked::alive == 0);
+
+    auto s = simple_stl::make_shared<std::string>(5, 'x');
+    REQUIRE(*s == "xxxxx");
+}
+
+TEST_CASE("allocate_shared 只分配一次", "[shared_ptr]") {
+    g_allocs = g_deallocs = 0;
+    {
+        auto p = simple_stl::allocate_shared<Tracked>(CountingAllocator<Tracked>(), 3);
+        REQUIRE(g_allocs == 1);
+        auto q = p;
+        auto r = std::move(q);
+        REQUIRE(p.use_count() == 2);
+        REQUIRE(g_allocs == 1);
+        REQUIRE(g_deallocs == 0);
+    }
+    REQUIRE(g_deallocs == 1);
+    REQUIRE(Tracked::alive == 0);
+
+    // 对象构造失败时归还内存
+    g_allocs = g_deallocs = 0;
+    REQUIRE_THROWS_AS(simple_stl::allocate_shared<Throwing>(CountingAllocator<Throwing>()), std::runtime_error);
+    REQUIRE(g_allocs == 1);
+    REQUIRE(g_deallocs == 1);
+}
+
+TEST_CASE("裸指针构造与 reset", "[shared_ptr]") {
+    {
+        simple_stl::shared_ptr<Tracked> p(new Tracked(1));
+        REQUIRE(p.use_count() == 1);
+        p.reset(new Tracked(2));
+        REQUIRE(Tracked::alive == 1);
+        REQUIRE(p->value == 2);
+        simple_stl::shared_ptr<Tracked> q;
+        q = p;
+        q = q;
+        REQUIRE(q.use_count() == 2);
+    }
+    REQUIRE(Tracked::alive == 0);
+}
+
+TEST_CASE("多线程拷贝计数", "[shared_ptr]") {
+    auto p = simple_stl::make_shared<Tracked>(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([p] {
+            for (int i = 0; i < 20000; ++i) {
+                auto copy = p;
+                (void)copy;
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    REQUIRE(p.use_count() == 1);
+}
+
+TEST_CASE("weak_ptr 与 lock", "[shared_ptr][weak_ptr]") {
+    simple_stl::weak_ptr<Tracked> w;
+    REQUIRE(w.expired());
+    REQUIRE(!w.lock());
+    {
+        auto p = simple_stl::make_shared<Tracked>(5);
+        w = p;
+        REQUIRE(w.use_count() == 1);
+        auto locked = w.lock();
+        REQUIRE(locked->value == 5);
+        REQUIRE(p.use_count() == 2);
+        simple_stl::shared_ptr<Tracked> from_weak(w);
+        REQUIRE(p.use_count() == 3);
+    }
+    // 对象已析构，但控制块仍被 weak_ptr 持有
+    REQUIRE(Tracked::alive == 0);
+    REQUIRE(w.expired());
+    REQUIRE(w.lock() == nullptr);
+    REQUIRE_THROWS_AS(simple_stl::shared_ptr<Tracked>(w), std::bad_weak_ptr);
+
+    // allocate_shared：弱引用存在时内存不归还，最后一个 weak_ptr 释放时才归还
+    g_allocs = g_deallocs = 0;
+    simple_stl::weak_ptr<Tracked> w2;
+    {
+        auto p = simple_stl::allocate_shared<Tracked>(CountingAllocator<Tracked>(), 1);
+        w2 = p;
+    }
+    REQUIRE(Tracked::alive == 0);
+    REQUIRE(g_deallocs == 0);
+    w2.reset();
+    REQUIRE(g_deallocs == 1);
+}
+
+TEST_CASE("自定义删除器与分配器", "[shared_ptr]") {
+    int deleted = 0;
+    {
+        simple_stl::shared_ptr<int> p(new int(3), [&deleted](int* q) { ++deleted; delete q; });
+        auto copy = p;
+        REQUIRE(deleted == 0);
+    }
+    REQUIRE(deleted == 1);
+
+    g_allocs = g_deallocs = 0;
+    {
+        simple_stl::shared_ptr<Tracked> p(new Tracked(4), simple_stl::default_delete<Tracked>(), CountingAllocator<Tracked>());
+        REQUIRE(g_allocs == 1); // 控制块由分配器分配
+        p.reset(new Tracked(5), [](Tracked* t) { delete t; });
+        REQUIRE(g_deallocs == 1);
+        REQUIRE(Tracked::alive == 1);
+    }
+    REQUIRE(Tracked::alive == 0);
+
+    simple_stl::shared_ptr<int> arr(new int[4]{1, 2, 3, 4}, simple_stl::default_delete<int[]>());
+    REQUIRE(arr.get()[3] == 4);
+}
+
+struct Base {
+    virtual ~Base() = default;
+    int base_value = 1;
+};
+struct Derived : Base {
+    int extra = 2;
+};
+
+TEST_CASE("别名构造与类型转换", "[shared_ptr]") {
+    struct Pair {
+        Tracked first{10};
+        Tracked second{20};
+    };
+    simple_stl::shared_ptr<Tracked> member;
+    {
+        auto owner = simple_stl::make_shared<Pair>();
+        member = simple_stl::shared_ptr<Tracked>(owner, &owner->second);
+        REQUIRE(owner.use_count() == 2);
+        REQUIRE(!member.owner_before(owner));
+        REQUIRE(!owner.owner_before(member));
+    }
+    // 成员指针让整个 Pair 保持存活
+    REQUIRE(Tracked::alive == 2);
+    REQUIRE(member->value == 20);
+    member.reset();
+    REQUIRE(Tracked::alive == 0);
+
+    simple_stl::shared_ptr<Base> b = simple_stl::make_shared<Derived>();
+    REQUIRE(b->base_value == 1);
+    auto d = simple_stl::dynamic_pointer_cast<Derived>(b);
+    REQUIRE(d);
+    REQUIRE(d->extra == 2);
+    REQUIRE(b.use_count() == 2);
+    auto s = simple_stl::static_pointer_cast<Derived>(b);
+    REQUIRE(s == d);
+    REQUIRE(!simple_stl::dynamic_pointer_cast<Tracked>(simple_stl::shared_ptr<Base>(new Base)));
+    simple_stl::shared_ptr<const Base> cb = b;
+    REQUIRE(simple_stl::const_pointer_cast<Base>(cb) == b);
+    simple_stl::weak_ptr<Base> wb = d;
+    REQUIRE(wb.lock() == b);
+}
+
+struct Node : simple_stl::enable_shared_from_this<Node> {
+    int id;
+    explicit Node(int i) : id(i) {}
+    simple_stl::shared_ptr<Node> self() { return shared_from_this(); }
+};
+
+TEST_CASE("enable_shared_from_this", "[shared_ptr]") {
+    auto a = simple_stl::make_shared<Node>(1);
+    auto self = a->self();
+    REQUIRE(self == a);
+    REQUIRE(a.use_count() == 2);
+
+    simple_stl::shared_ptr<Node> b(new Node(2));
+    REQUIRE(b->self() == b);
+    REQUIRE(b->weak_from_this().use_count() == 1);
+
+    // 未被 shared_ptr 管理的对象不能 shared_from_this
+    Node stack_node(3);
+    REQUIRE_THROWS_AS(stack_node.self(), std::bad_weak_ptr);
+    // 拷贝出来的对象属于新的所有者
+    auto c = simple_stl::make_shared<Node>(*a);
+    REQUIRE(c->self() == c);
+    REQUIRE(c->self() != a);
+}
+
+struct LocalNode : simple_stl::enable_shared_from_this<LocalNode, simple_stl::local_refcount> {
+    int id;
+    explicit LocalNode(int i) : id(i) {}
+    simple_stl::local_weak_ptr<LocalNode> parent;
+    simple_stl::local_shared_ptr<LocalNode> child;
+};
+
+TEST_CASE("local_shared_ptr 单线程计数", "[shared_ptr][local]") {
+    static_assert(std::is_same<simple_stl::local_shared_ptr<int>::policy_type, simple_stl::local_refcount>::value, "");
+    static_assert(std::is_same<simple_stl::shared_ptr<int>::policy_type, simple_stl::atomic_refcount>::value, "");
+    // 两种 shared_ptr 之间不能互相转换
+    static_assert(!std::is_convertible<simple_stl::local_shared_ptr<int>, simple_stl::shared_ptr<int>>::value, "");
+
+    {
+        auto p = simple_stl::make_local_shared<Tracked>(8);
+        auto q = p;
+        REQUIRE(p.use_count() == 2);
+        simple_stl::local_weak_ptr<Tracked> w = p;
+        q.reset();
+        REQUIRE(w.lock()->value == 8);
+        p.reset();
+        REQUIRE(Tracked::alive == 0);
+        REQUIRE(w.expired());
+        REQUIRE_THROWS_AS(simple_stl::local_shared_ptr<Tracked>(w), std::bad_weak_ptr);
+    }
+
+    g_allocs = g_deallocs = 0;
+    {
+        auto p = simple_stl::allocate_local_shared<Tracked>(CountingAllocator<Tracked>(), 1);
+        simple_stl::local_shared_ptr<Tracked> r(new Tracked(2), simple_stl::default_delete<Tracked>(), CountingAllocator<Tracked>());
+        REQUIRE(g_allocs == 2);
+    }
+    REQUIRE(g_deallocs == 2);
+    REQUIRE(Tracked::alive == 0);
+
+    // 单线程的父子结构：父指向子用强引用，子指向父用弱引用
+    auto root = simple_stl::make_local_shared<LocalNode>(1);
+    root->child = simple_stl::make_local_shared<LocalNode>(2);
+    root->child->parent = root->shared_from_this();
+    REQUIRE(root.use_count() == 1);
+    REQUIRE(root->child->parent.lock() == root);
+    simple_stl::local_shared_ptr<const LocalNode> croot = root;
+    REQUIRE(simple_stl::const_pointer_cast<LocalNode>(croot) == root);
+}
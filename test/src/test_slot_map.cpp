@@ -0,0 +1,97 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/slot_map.h"
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using simple_stl::slot_map;
+
+TEST_CASE("句柄的插入、查找与删除", "[slot_map]") {
+    slot_map<std::string> sm;
+    auto a = sm.insert("alpha");
+    auto b = sm.emplace(3, 'b');
+    auto c = sm.insert(std::string("gamma"));
+    REQUIRE(sm.size() == 3);
+    REQUIRE(sm[a] == "alpha");
+    REQUIRE(sm.at(b) == "bbb");
+    REQUIRE(*sm.find(c) == "gamma");
+    REQUIRE(!sm.contains(slot_map<std::string>::null_handle));
+
+    REQUIRE(sm.erase(a));
+    REQUIRE(!sm.erase(a));
+    REQUIRE(!sm.contains(a));
+    REQUIRE(sm.find(a) == nullptr);
+    REQUIRE_THROWS_AS(sm.at(a), std::out_of_range);
+    // 其他句柄不受搬移影响
+    REQUIRE(sm[b] == "bbb");
+    REQUIRE(sm[c] == "gamma");
+
+    // 复用槽位后旧句柄仍然无效
+    auto d = sm.insert("delta");
+    REQUIRE(slot_map<std::string>::slot_of(d) == slot_map<std::string>::slot_of(a));
+    REQUIRE(d != a);
+    REQUIRE(!sm.contains(a));
+    REQUIRE(sm[d] == "delta");
+
+    // 参数引用容器内的元素
+    auto e = sm.insert(sm[d]);
+    REQUIRE(sm[e] == "delta");
+}
+
+TEST_CASE("与 std::map 随机对拍", "[slot_map]") {
+    slot_map<int> sm;
+    std::map<slot_map<int>::handle, int> ref;
+    std::vector<slot_map<int>::handle> dead;
+    std::mt19937 rng(13);
+    for (int step = 0; step < 50000; ++step) {
+        if (ref.empty() || rng() % 5 < 3) {
+            auto h = sm.insert(step);
+            REQUIRE(ref.count(h) == 0);
+            ref[h] = step;
+        } else {
+            auto it = ref.begin();
+            std::advance(it, rng() % ref.size());
+            REQUIRE(sm.erase(it->first));
+            dead.push_back(it->first);
+            ref.erase(it);
+        }
+        if (step % 5000 == 0) {
+            REQUIRE(sm.size() == ref.size());
+            for (const auto& kv : ref) REQUIRE(sm.at(kv.first) == kv.second);
+            for (auto h : dead) REQUIRE(!sm.contains(h));
+            // 紧密遍历：每个元素都能通过 handle_at 回到自己的句柄
+            long long sum = 0;
+            for (std::size_t i = 0; i < sm.size(); ++i) {
+                REQUIRE(ref.at(sm.handle_at(i)) == sm.data()[i]);
+                sum += sm.data()[i];
+            }
+            long long expect = 0;
+            for (const auto& kv : ref) expect += kv.second;
+            REQUIRE(sum == expect);
+            REQUIRE(std::accumulate(sm.begin(), sm.end(), 0LL) == expect);
+        }
+    }
+}
+
+TEST_CASE("clear 使所有句柄失效", "[slot_map]") {
+    slot_map<int> sm;
+    std::vector<slot_map<int>::handle> hs;
+    for (int i = 0; i < 100; ++i) hs.push_back(sm.insert(i));
+    sm.clear();
+    REQUIRE(sm.empty());
+    for (auto h : hs) REQUIRE(!sm.contains(h));
+    for (int i = 0; i < 100; ++i) {
+        auto h = sm.insert(i);
+        REQUIRE(std::find(hs.begin(), hs.end(), h) == hs.end());
+    }
+    REQUIRE(sm.size() == 100);
+
+    slot_map<int> other;
+    other.swap(sm);
+    REQUIRE(other.size() == 100);
+    REQUIRE(sm.empty());
+}
@@ -0,0 +1,73 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/string_split.h"
+#include <string>
+#include <vector>
+
+// 与 test_string_allfunc.cpp 一致，在测试中定义最小容量
+const simple_stl::string::size_type simple_stl::string::str_min_capacity = 16;
+
+template <typename Range>
+static std::vector<std::string> collect(const Range& range) {
+    std::vector<std::string> out;
+    for (std::string_view field : range) {
+        out.emplace_back(field);
+    }
+    return out;
+}
+
+TEST_CASE("按单字符切分", "[string_split][char]") {
+    simple_stl::string line("a,bb,,ccc,");
+    REQUIRE(collect(simple_stl::split(line, ',')) == std::vector<std::string>{"a", "bb", "", "ccc", ""});
+    REQUIRE(collect(simple_stl::tokenize(line, ',')) == std::vector<std::string>{"a", "bb", "ccc"});
+
+    SECTION("字段是指向原缓冲区的视图") {
+        auto range = simple_stl::split(line, ',');
+        auto it = range.begin();
+        REQUIRE(it->data() == line.data());
+        ++it;
+        REQUIRE(it->data() == line.data() + 2);
+    }
+
+    SECTION("边界情况") {
+        REQUIRE(collect(simple_stl::split("", ',')) == std::vector<std::string>{""});
+        REQUIRE(collect(simple_stl::tokenize("", ',')).empty());
+        REQUIRE(collect(simple_stl::tokenize(",,,", ',')).empty());
+        REQUIRE(collect(simple_stl::split("abc", ',')) == std::vector<std::string>{"abc"});
+    }
+}
+
+TEST_CASE("按字符集合切分", "[string_split][any_of]") {
+    // 超过16字节，覆盖 SSE2 主循环与尾部查表两条路径
+    const char* log = "2024-01-01 12:00:00\tINFO  worker=3 msg=started;pid=42";
+    std::vector<std::string> expected = {"2024-01-01", "12:00:00", "INFO", "worker=3", "msg=started", "pid=42"};
+    REQUIRE(collect(simple_stl::tokenize_any_of(log, " \t;")) == expected);
+
+    // 集合较大时走查表路径
+    REQUIRE(collect(simple_stl::split_any_of("a1b2c3d4e5f6g7h8i9j", "0123456789")) ==
+            std::vector<std::string>{"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"});
+
+    REQUIRE_THROWS_AS(simple_stl::split_any_of("abc", ""), std::invalid_argument);
+}
+
+TEST_CASE("按子串切分", "[string_split][substr]") {
+    REQUIRE(collect(simple_stl::split("k1=v1&&k2=v2&&&&k3", "&&")) ==
+            std::vector<std::string>{"k1=v1", "k2=v2", "", "k3"});
+    REQUIRE(collect(simple_stl::tokenize("k1=v1&&k2=v2&&&&k3", "&&")) ==
+            std::vector<std::string>{"k1=v1", "k2=v2", "k3"});
+    // 首字符命中但整体不匹配
+    REQUIRE(collect(simple_stl::split("a&b&&c&", "&&")) == std::vector<std::string>{"a&b", "c&"});
+
+    REQUIRE_THROWS_AS(simple_stl::split("abc", std::string_view()), std::invalid_argument);
+}
+
+TEST_CASE("嵌套切分 CSV", "[string_split][csv]") {
+    simple_stl::string csv("id,name\n1,alice\n2,bob\n");
+    std::vector<std::vector<std::string>> rows;
+    for (std::string_view line : simple_stl::tokenize(csv, '\n')) {
+        rows.push_back(collect(simple_stl::split(line, ',')));
+    }
+    REQUIRE(rows.size() == 3);
+    REQUIRE(rows[0] == std::vector<std::string>{"id", "name"});
+    REQUIRE(rows[2] == std::vector<std::string>{"2", "bob"});
+}
@@ -0,0 +1,122 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "tools/threadpool.h"
+#include "tools/workstealingdeque.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Chase-Lev 双端队列：每个元素恰好被取走一次", "[WorkStealingDeque]") {
+    const int kItems = 200000;
+    const int kThieves = 3;
+    WorkStealingDeque<int*> deque(4); // 从很小的容量开始，覆盖扩容路径
+    std::vector<int> values(kItems);
+    std::vector<std::atomic<int>> taken(kItems);
+    for (auto& t : taken) t = 0;
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < kThieves; ++i) {
+        thieves.emplace_back([&] {
+            int* p = nullptr;
+            while (!done.load()) {
+                if (deque.Steal(p)) ++taken[p - values.data()];
+            }
+            while (deque.Steal(p)) ++taken[p - values.data()];
+        });
+    }
+    // 所有者交替压入和弹出
+    int* p = nullptr;
+    for (int i = 0; i < kItems; ++i) {
+        deque.Push(&values[i]);
+        if (i % 3 == 0 && deque.Pop(p)) ++taken[p - values.data()];
+    }
+    while (deque.Pop(p)) ++taken[p - values.data()];
+    done = true;
+    for (auto& t : thieves) t.join();
+
+    int wrong = 0;
+    for (auto& t : taken) wrong += (t.load() != 1);
+    REQUIRE(wrong == 0);
+    REQUIRE(deque.Empty());
+}
+
+TEST_CASE("所有者后进先出，窃取者先进先出", "[WorkStealingDeque]") {
+    WorkStealingDeque<int*> deque;
+    int a = 1, b = 2, c = 3;
+    deque.Push(&a);
+    deque.Push(&b);
+    deque.Push(&c);
+    int* p = nullptr;
+    REQUIRE(deque.Pop(p));
+    REQUIRE(p == &c);
+    REQUIRE(deque.Steal(p));
+    REQUIRE(p == &a);
+    REQUIRE(deque.Size() == 1);
+    REQUIRE(deque.Pop(p));
+    REQUIRE(p == &b);
+    REQUIRE(!deque.Pop(p));
+    REQUIRE(!deque.Steal(p));
+}
+
+// 递归拆分区间：每个任务在工作线程内继续 Post 子任务
+static void parallel_sum(ThreadPool& pool, const std::vector<int>& data, size_t lo, size_t hi,
+                         std::atomic<long>& sum, std::atomic<int>& leaves) {
+    if (hi - lo <= 64) {
+        long s = 0;
+        for (size_t i = lo; i < hi; ++i) s += data[i];
+        sum += s;
+        ++leaves;
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    pool.Post([&pool, &data, lo, mid, &sum, &leaves] { parallel_sum(pool, data, lo, mid, sum, leaves); });
+    parallel_sum(pool, data, mid, hi, sum, leaves);
+}
+
+TEST_CASE("工作窃取模式：细粒度递归任务", "[ThreadPool]") {
+    std::vector<int> data(1 << 16);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<int>(i % 1000);
+    long expect = 0;
+    for (int v : data) expect += v;
+
+    std::atomic<long> sum{0};
+    std::atomic<int> leaves{0};
+    {
+        ThreadPool pool(4, ThreadPool::Mode::WorkStealing);
+        pool.Post([&] { parallel_sum(pool, data, 0, data.size(), sum, leaves); });
+        auto start = std::chrono::steady_clock::now();
+        while (leaves < 1024) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (std::chrono::steady_clock::now() - start > std::chrono::seconds(10)) {
+                FAIL("任务执行超时");
+            }
+        }
+    }
+    REQUIRE(sum == expect);
+}
+
+TEST_CASE("工作窃取模式：外部多线程提交，析构前执行完所有任务", "[ThreadPool]") {
+    std::atomic<int> done{0};
+    const int kProducers = 4, kTasks = 5000;
+    {
+        ThreadPool pool(3, ThreadPool::Mode::WorkStealing);
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&] {
+                for (int i = 0; i < kTasks; ++i) pool.Post([&done](int n) { done += n; }, 1);
+            });
+        }
+        for (auto& t : producers) t.join();
+    }
+    REQUIRE(done == kProducers * kTasks);
+
+    // 默认仍是共享队列模式
+    std::atomic<int> shared_done{0};
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 100; ++i) pool.Post([&shared_done] { ++shared_done; });
+    }
+    REQUIRE(shared_done == 100);
+}
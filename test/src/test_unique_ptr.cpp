@@ -0,0 +1,112 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "common/unique_ptr.h"
+#include "common/shared_ptr.h"
+#include "containers/vector.h"
+#include <string>
+
+struct Tracked {
+    static int alive;
+    int value;
+    explicit Tracked(int v) : value(v) { ++alive; }
+    virtual ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+struct Child : Tracked {
+    explicit Child(int v) : Tracked(v) {}
+};
+
+// 有状态删除器：记录删除次数
+struct CountingDelete {
+    int* count;
+    void operator()(Tracked* p) const { ++*count; delete p; }
+};
+
+TEST_CASE("空基类优化：无状态删除器不占空间", "[unique_ptr]") {
+    auto lambda = [](int* p) { delete p; };
+    STATIC_REQUIRE(sizeof(simple_stl::unique_ptr<int>) == sizeof(int*));
+    STATIC_REQUIRE(sizeof(simple_stl::unique_ptr<int[]>) == sizeof(int*));
+    STATIC_REQUIRE(sizeof(simple_stl::unique_ptr<int, decltype(lambda)>) == sizeof(int*));
+    STATIC_REQUIRE(sizeof(simple_stl::unique_ptr<Tracked, CountingDelete>) == 2 * sizeof(void*));
+    STATIC_REQUIRE(sizeof(simple_stl::compressed_pair<int, simple_stl::default_delete<int>>) == sizeof(int));
+    STATIC_REQUIRE(!std::is_copy_constructible<simple_stl::unique_ptr<int>>::value);
+
+    simple_stl::unique_ptr<int, decltype(lambda)> p(new int(3), lambda);
+    REQUIRE(*p == 3);
+}
+
+TEST_CASE("所有权的转移、释放与重置", "[unique_ptr]") {
+    {
+        auto p = simple_stl::make_unique<Tracked>(1);
+        REQUIRE(p->value == 1);
+        auto q = std::move(p);
+        REQUIRE(p == nullptr);
+        REQUIRE(q != nullptr);
+        REQUIRE(Tracked::alive == 1);
+
+        q.reset(new Tracked(2));
+        REQUIRE(Tracked::alive == 1);
+        REQUIRE((*q).value == 2);
+
+        Tracked* raw = q.release();
+        REQUIRE(!q);
+        simple_stl::unique_ptr<Tracked> back(raw);
+
+        // 派生类转换为基类，虚析构保证正确销毁
+        simple_stl::unique_ptr<Tracked> base = simple_stl::make_unique<Child>(3);
+        base = simple_stl::make_unique<Child>(4);
+        REQUIRE(base->value == 4);
+        REQUIRE(Tracked::alive == 2);
+        base = nullptr;
+        REQUIRE(Tracked::alive == 1);
+        back.swap(base);
+        REQUIRE(!back);
+        REQUIRE(base->value == 2);
+    }
+    REQUIRE(Tracked::alive == 0);
+
+    int deleted = 0;
+    {
+        simple_stl::unique_ptr<Tracked, CountingDelete> p(new Tracked(5), CountingDelete{&deleted});
+        simple_stl::unique_ptr<Tracked, CountingDelete> q(std::move(p));
+        REQUIRE(q.get_deleter().count == &deleted);
+        REQUIRE(deleted == 0);
+    }
+    REQUIRE(deleted == 1);
+}
+
+TEST_CASE("数组版本", "[unique_ptr]") {
+    auto arr = simple_stl::make_unique<int[]>(8);
+    for (int i = 0; i < 8; ++i) REQUIRE(arr[i] == 0); // 值初始化
+    arr[3] = 7;
+    REQUIRE(arr.get()[3] == 7);
+    simple_stl::unique_ptr<std::string[]> strs(new std::string[2]{"a", "b"});
+    REQUIRE(strs[1] == "b");
+    strs.reset();
+    REQUIRE(!strs);
+}
+
+TEST_CASE("作为容器元素与升级为 shared_ptr", "[unique_ptr]") {
+    {
+        simple_stl::vector<simple_stl::unique_ptr<Tracked>> v;
+        for (int i = 0; i < 100; ++i) v.push_back(simple_stl::make_unique<Tracked>(i));
+        REQUIRE(Tracked::alive == 100);
+        REQUIRE(v[99]->value == 99);
+        v.pop_back();
+        REQUIRE(Tracked::alive == 99);
+    }
+    REQUIRE(Tracked::alive == 0);
+
+    int deleted = 0;
+    {
+        simple_stl::unique_ptr<Tracked, CountingDelete> u(new Tracked(6), CountingDelete{&deleted});
+        simple_stl::shared_ptr<Tracked> s(std::move(u));
+        REQUIRE(!u);
+        REQUIRE(s->value == 6);
+        simple_stl::shared_ptr<Tracked> from_child = simple_stl::make_unique<Child>(7);
+        REQUIRE(from_child.use_count() == 1);
+    }
+    REQUIRE(deleted == 1);
+    REQUIRE(Tracked::alive == 0);
+}
@@ -0,0 +1,115 @@
+#define CATCH_CONFIG_MAIN
+#include "catch_amalgamated.hpp"
+#include "containers/unrolled_list.h"
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename List>
+static std::vector<typename List::value_type> to_vec(const List& l) {
+    std::vector<typename List::value_type> out;
+    for (const auto& v : l) out.push_back(v);
+    return out;
+}
+
+TEST_CASE("节点容量按缓存行计算", "[unrolled_list]") {
+    // 默认128字节节点，去掉24字节链接头
+    REQUIRE(simple_stl::unrolled_list<int>::node_capacity == (128 - 24) / sizeof(int));
+    REQUIRE(simple_stl::unrolled_list<std::string, simple_stl::allocator<std::string>, 64>::node_capacity >= 1);
+}
+
+TEST_CASE("头尾插入与双向遍历", "[unrolled_list]") {
+    simple_stl::unrolled_list<int> list;
+    for (int i = 0; i < 100; ++i) list.push_back(i);
+    for (int i = -1; i >= -50; --i) list.push_front(i);
+    REQUIRE(list.size() == 150);
+    REQUIRE(list.front() == -50);
+    REQUIRE(list.back() == 99);
+
+    int expected = -50;
+    for (int v : list) {
+        REQUIRE(v == expected++);
+    }
+    // 反向遍历
+    expected = 99;
+    for (auto it = list.end(); it != list.begin();) {
+        --it;
+        REQUIRE(*it == expected--);
+    }
+    // 顺序追加会把节点填满
+    simple_stl::unrolled_list<int> seq;
+    for (int i = 0; i < 260; ++i) seq.push_back(i);
+    REQUIRE(seq.node_count() == 10);
+
+    list.pop_front();
+    list.pop_back();
+    REQUIRE(list.front() == -49);
+    REQUIRE(list.back() == 98);
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+    REQUIRE_THROWS_AS(list.pop_back(), std::out_of_range);
+}
+
+TEST_CASE("中间插入删除与 std::list 对比", "[unrolled_list]") {
+    simple_stl::unrolled_list<int, simple_stl::allocator<int>, 64> list; // 小节点更容易触发分裂与合并
+    std::list<int> ref;
+    std::mt19937 rng(42);
+
+    for (int step = 0; step < 5000; ++step) {
+        size_t n = ref.size();
+        size_t pos = n ? rng() % (n + 1) : 0;
+        auto it = list.begin();
+        auto rit = ref.begin();
+        for (size_t i = 0; i < pos; ++i) { ++it; ++rit; }
+
+        if (rng() % 3 != 0 || n == 0) {
+            int v = static_cast<int>(rng() % 1000);
+            auto ins = list.insert(it, v);
+            ref.insert(rit, v);
+            REQUIRE(*ins == v);
+        } else {
+            if (pos == n) { --it; --rit; }
+            auto next = list.erase(it);
+            auto rnext = ref.erase(rit);
+            if (rnext == ref.end()) {
+                REQUIRE(next == list.end());
+            } else {
+                REQUIRE(*next == *rnext);
+            }
+        }
+        REQUIRE(list.size() == ref.size());
+    }
+    REQUIRE(to_vec(list) == std::vector<int>(ref.begin(), ref.end()));
+
+    // 区间删除
+    auto first = list.begin();
+    auto last = first;
+    for (int i = 0; i < 10; ++i) ++last;
+    list.erase(first, last);
+    ref.erase(ref.begin(), std::next(ref.begin(), 10));
+    REQUIRE(to_vec(list) == std::vector<int>(ref.begin(), ref.end()));
+}
+
+TEST_CASE("拷贝、移动与 move-only 元素", "[unrolled_list]") {
+    simple_stl::unrolled_list<std::string> a{"a", "b", "c"};
+    simple_stl::unrolled_list<std::string> b(a);
+    b.insert(++b.begin(), "x");
+    REQUIRE(to_vec(a) == std::vector<std::string>{"a", "b", "c"});
+    REQUIRE(to_vec(b) == std::vector<std::string>{"a", "x", "b", "c"});
+
+    simple_stl::unrolled_list<std::string> c(std::move(b));
+    REQUIRE(b.empty());
+    REQUIRE(c.size() == 4);
+    a = c;
+    REQUIRE(to_vec(a) == to_vec(c));
+
+    simple_stl::unrolled_list<std::unique_ptr<int>> ptrs;
+    for (int i = 0; i < 40; ++i) ptrs.emplace_back(new int(i));
+    ptrs.emplace(ptrs.begin(), new int(-1)); // 首节点已满，触发分裂
+    REQUIRE(*ptrs.front() == -1);
+    REQUIRE(*ptrs.back() == 39);
+    REQUIRE(ptrs.size() == 41);
+}
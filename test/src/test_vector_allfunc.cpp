@@ -6,6 +6,10 @@
 #include <common/utilities.h> 
 #include <common/shared_ptr.h>
 #include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
 
 TEST_CASE("minimal segfault test with detailed logs") {
     
@@ -250,4 +254,69 @@ TEST_CASE("Move Assignment Operator", "[vector]") {
         REQUIRE(dest.size() == 0);
         REQUIRE(src.size() == 0);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("vector 迭代器与标准算法", "[vector][iterator]") {
+    simple_stl::vector<int> vec;
+    for (int v : {5, 3, 9, 1}) vec.push_back(v);
+
+    std::sort(vec.begin(), vec.end());
+    REQUIRE(vec[0] == 1);
+    REQUIRE(vec[3] == 9);
+
+    std::vector<int> rev(vec.rbegin(), vec.rend());
+    REQUIRE(rev == std::vector<int>{9, 5, 3, 1});
+    REQUIRE(vec.rbegin()[1] == 5);
+    REQUIRE(vec.rend() - vec.rbegin() == 4);
+
+    const simple_stl::vector<int>& cvec = vec;
+    REQUIRE(*cvec.crbegin() == 9);
+    REQUIRE(std::accumulate(cvec.cbegin(), cvec.cend(), 0) == 18);
+    REQUIRE(cvec.begin() == cvec.start());
+
+#if __cplusplus >= 202002L
+    static_assert(std::contiguous_iterator<simple_stl::vector<int>::iterator>);
+    static_assert(std::random_access_iterator<simple_stl::vector<int>::reverse_iterator>);
+#endif
+}
+
+TEST_CASE("vector 中间插入与删除", "[vector]") {
+    simple_stl::vector<std::string> vec;
+    vec.push_back("a");
+    vec.push_back("d");
+    vec.insert(vec.begin() + 1, "c");
+    vec.insert(vec.begin() + 1, std::string("b"));
+    vec.emplace(vec.end(), 1, 'e');
+    vec.insert(vec.begin(), vec[4]); // 参数引用容器内元素，插入后仍应是原值
+    REQUIRE(vec.size() == 6);
+    REQUIRE(vec.front() == "e");
+    REQUIRE(vec.back() == "e");
+    REQUIRE(vec[1] == "a");
+    REQUIRE(vec[3] == "c");
+
+    auto it = vec.erase(vec.begin());
+    REQUIRE(*it == "a");
+    it = vec.erase(vec.begin() + 1, vec.begin() + 3);
+    REQUIRE(*it == "d");
+    REQUIRE(vec.size() == 3);
+    REQUIRE(vec.data()[2] == "e");
+    REQUIRE(vec.erase(vec.end(), vec.end()) == vec.end());
+}
+
+TEST_CASE("vector resize", "[vector]") {
+    simple_stl::vector<std::string> vec;
+    vec.resize(3);
+    REQUIRE(vec.size() == 3);
+    REQUIRE(vec[2].empty());
+    vec[0] = "x";
+    vec.resize(10, vec[0]); // 参数引用容器内元素，扩容后仍应是原值
+    REQUIRE(vec.size() == 10);
+    REQUIRE(vec[9] == "x");
+    REQUIRE(vec[5] == "x");
+    vec.resize(1);
+    REQUIRE(vec.size() == 1);
+    REQUIRE(vec.back() == "x");
+
+    simple_stl::vector<int> ints;
+    ints.resize(5);
+    REQUIRE(ints[4] == 0);
+}